@@ -355,11 +355,7 @@ class Plugin(Structure):
         return Port.wrap(self, c.plugin_get_port_by_index(self.plugin, index))
 
     def get_port_by_symbol(self, symbol):
-        """Get a port on `plugin` by `symbol`.
-
-        Note this function is slower than get_port_by_index(),
-        especially on plugins with a very large number of ports.
-        """
+        """Get a port on `plugin` by `symbol`."""
         assert _is_string(symbol) or isinstance(symbol, Node)
         if _is_string(symbol):
             symbol = self.world.new_string(symbol)
@@ -909,6 +905,7 @@ class Collection(Structure):
         iter_get,
         iter_next,
         is_end,
+        get_at,
     ):
         assert isinstance(world, World)
         self.world = world
@@ -918,6 +915,7 @@ class Collection(Structure):
         self.iter_get = iter_get
         self.iter_next = iter_next
         self.is_end = is_end
+        self.get_at = get_at
 
     def __iter__(self):
         return Iter(
@@ -930,19 +928,11 @@ class Collection(Structure):
         )
 
     def __getitem__(self, index):
-        pos = 0
-        it = self.iter_begin(self.collection)
-
-        while not self.is_end(self.collection, it):
-            if pos == index:
-                return self.constructor(
-                    self.world, self.iter_get(self.collection, it)
-                )
-
-            it = self.iter_next(self.collection, it)
-            pos = pos + 1
+        element = self.get_at(self.collection, index) if index >= 0 else None
+        if not element:
+            raise IndexError(index)
 
-        raise IndexError(index)
+        return self.constructor(self.world, element)
 
     def begin(self):
         return self.__iter__()
@@ -969,6 +959,7 @@ class Plugins(Collection):
             c.plugins_get,
             c.plugins_next,
             c.plugins_is_end,
+            c.plugins_get_at,
         )
         self.world = world
 
@@ -1011,6 +1002,7 @@ class PluginClasses(Collection):
             c.plugin_classes_get,
             c.plugin_classes_next,
             c.plugin_classes_is_end,
+            c.plugin_classes_get_at,
         )
 
     def __del__(self):
@@ -1060,6 +1052,7 @@ class UIs(Collection):
             c.uis_get,
             c.uis_next,
             c.uis_is_end,
+            c.uis_get_at,
         )
 
     def __del__(self):
@@ -1109,6 +1102,7 @@ class Nodes(Collection):
             c.nodes_get,
             c.nodes_next,
             c.nodes_is_end,
+            c.nodes_get_at,
         )
 
     def __del__(self):
@@ -1622,6 +1616,7 @@ _cfunc("plugin_classes_free", None, P(PluginClasses))
 _cfunc("plugin_classes_size", c_uint, P(PluginClasses))
 _cfunc("plugin_classes_begin", P(Iter), P(PluginClasses))
 _cfunc("plugin_classes_get", P(PluginClass), P(PluginClasses), P(Iter))
+_cfunc("plugin_classes_get_at", P(PluginClass), P(PluginClasses), c_uint)
 _cfunc("plugin_classes_next", P(Iter), P(PluginClasses), P(Iter))
 _cfunc("plugin_classes_is_end", c_bool, P(PluginClasses), P(Iter))
 _cfunc("plugin_classes_get_by_uri", P(PluginClass), P(PluginClasses), P(Node))
@@ -1629,12 +1624,14 @@ _cfunc("scale_points_free", None, P(ScalePoints))
 _cfunc("scale_points_size", c_uint, P(ScalePoints))
 _cfunc("scale_points_begin", P(Iter), P(ScalePoints))
 _cfunc("scale_points_get", P(ScalePoint), P(ScalePoints), P(Iter))
+_cfunc("scale_points_get_at", P(ScalePoint), P(ScalePoints), c_uint)
 _cfunc("scale_points_next", P(Iter), P(ScalePoints), P(Iter))
 _cfunc("scale_points_is_end", c_bool, P(ScalePoints), P(Iter))
 _cfunc("uis_free", None, P(UIs))
 _cfunc("uis_size", c_uint, P(UIs))
 _cfunc("uis_begin", P(Iter), P(UIs))
 _cfunc("uis_get", P(UI), P(UIs), P(Iter))
+_cfunc("uis_get_at", P(UI), P(UIs), c_uint)
 _cfunc("uis_next", P(Iter), P(UIs), P(Iter))
 _cfunc("uis_is_end", c_bool, P(UIs), P(Iter))
 _cfunc("uis_get_by_uri", P(UI), P(UIs), P(Node))
@@ -1642,6 +1639,7 @@ _cfunc("nodes_free", None, P(Nodes))
 _cfunc("nodes_size", c_uint, P(Nodes))
 _cfunc("nodes_begin", P(Iter), P(Nodes))
 _cfunc("nodes_get", P(Node), P(Nodes), P(Iter))
+_cfunc("nodes_get_at", P(Node), P(Nodes), c_uint)
 _cfunc("nodes_next", P(Iter), P(Nodes), P(Iter))
 _cfunc("nodes_is_end", c_bool, P(Nodes), P(Iter))
 _cfunc("nodes_get_first", P(Node), P(Nodes))
@@ -1650,6 +1648,7 @@ _cfunc("nodes_merge", P(Nodes), P(Nodes), P(Nodes))
 _cfunc("plugins_size", c_uint, P(Plugins))
 _cfunc("plugins_begin", P(Iter), P(Plugins))
 _cfunc("plugins_get", P(Plugin), P(Plugins), P(Iter))
+_cfunc("plugins_get_at", P(Plugin), P(Plugins), c_uint)
 _cfunc("plugins_next", P(Iter), P(Plugins), P(Iter))
 _cfunc("plugins_is_end", c_bool, P(Plugins), P(Iter))
 _cfunc("plugins_get_by_uri", P(Plugin), P(Plugins), P(Node))
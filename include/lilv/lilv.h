@@ -88,6 +88,7 @@ typedef struct LilvNodeImpl        LilvNode;        /**< Typed Value. */
 typedef struct LilvWorldImpl       LilvWorld;       /**< Lilv World. */
 typedef struct LilvInstanceImpl    LilvInstance;    /**< Plugin instance. */
 typedef struct LilvStateImpl       LilvState;       /**< Plugin state. */
+typedef struct LilvFeatureSetImpl  LilvFeatureSet;  /**< Host features. */
 
 typedef void LilvIter;          /**< Collection iterator */
 typedef void LilvPluginClasses; /**< A set of #LilvPluginClass. */
@@ -284,6 +285,15 @@ lilv_node_is_string(const LilvNode* LILV_NULLABLE value);
 LILV_API const char* LILV_UNSPECIFIED
 lilv_node_as_string(const LilvNode* LILV_NULLABLE value);
 
+/**
+   Return `value` as a string, and set `length` to its length in bytes.
+
+   This is like lilv_node_as_string(), but avoids the need to call strlen().
+*/
+LILV_API const char* LILV_NONNULL
+lilv_node_as_string_counted(const LilvNode* LILV_NONNULL value,
+                            size_t* LILV_NONNULL         length);
+
 /**
    Return the path of a file URI node.
 
@@ -342,12 +352,22 @@ lilv_node_as_bool(const LilvNode* LILV_NULLABLE value);
    @defgroup lilv_collections Collections
 
    Lilv has several collection types for holding various types of value.
-   Each collection type supports a similar basic API, except #LilvPlugins which
-   is internal and thus lacks a free function:
+   Each collection type supports a similar basic API:
 
    - void PREFIX_free (coll)
    - unsigned PREFIX_size (coll)
    - LilvIter* PREFIX_begin (coll)
+   - const ELEMENT* PREFIX_get_at (coll, index)
+
+   Elements are stored contiguously, so they can be accessed by index with
+   PREFIX_get_at(), which returns null if the index is out of range.  Plugins,
+   plugin classes, and UIs are sorted by URI, and scale points returned by
+   lilv_port_get_scale_points() are sorted by value.  Nodes are in the order
+   they were found.
+
+   Iterators point directly into this storage, so a collection must not be
+   modified while it is being iterated over, and any iterators into it are
+   invalid after it changes.
 
    The types of collection are:
 
@@ -386,6 +406,12 @@ lilv_plugin_classes_free(LilvPluginClasses* LILV_NULLABLE collection);
 LILV_API unsigned
 lilv_plugin_classes_size(const LilvPluginClasses* LILV_NULLABLE collection);
 
+/**
+   Return an iterator to the first element of `collection`.
+
+   The iterator points into the storage of the collection, so it is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_plugin_classes_begin(const LilvPluginClasses* LILV_NULLABLE collection);
 
@@ -393,6 +419,16 @@ LILV_API const LilvPluginClass* LILV_UNSPECIFIED
 lilv_plugin_classes_get(const LilvPluginClasses* LILV_UNSPECIFIED collection,
                         const LilvIter* LILV_NULLABLE             i);
 
+LILV_API const LilvPluginClass* LILV_NULLABLE
+lilv_plugin_classes_get_at(const LilvPluginClasses* LILV_NULLABLE collection,
+                           unsigned                               index);
+
+/**
+   Return an iterator to the element after `i` in `collection`.
+
+   Like the iterator returned by lilv_plugin_classes_begin(), this is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_plugin_classes_next(const LilvPluginClasses* LILV_UNSPECIFIED collection,
                          LilvIter* LILV_NULLABLE                   i);
@@ -421,6 +457,12 @@ lilv_scale_points_free(LilvScalePoints* LILV_NULLABLE collection);
 LILV_API unsigned
 lilv_scale_points_size(const LilvScalePoints* LILV_NULLABLE collection);
 
+/**
+   Return an iterator to the first element of `collection`.
+
+   The iterator points into the storage of the collection, so it is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_scale_points_begin(const LilvScalePoints* LILV_NULLABLE collection);
 
@@ -428,6 +470,16 @@ LILV_API const LilvScalePoint* LILV_UNSPECIFIED
 lilv_scale_points_get(const LilvScalePoints* LILV_UNSPECIFIED collection,
                       const LilvIter* LILV_NULLABLE           i);
 
+LILV_API const LilvScalePoint* LILV_NULLABLE
+lilv_scale_points_get_at(const LilvScalePoints* LILV_NULLABLE collection,
+                         unsigned                             index);
+
+/**
+   Return an iterator to the element after `i` in `collection`.
+
+   Like the iterator returned by lilv_scale_points_begin(), this is invalidated
+   by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_scale_points_next(const LilvScalePoints* LILV_UNSPECIFIED collection,
                        LilvIter* LILV_NULLABLE                 i);
@@ -444,6 +496,12 @@ lilv_uis_free(LilvUIs* LILV_NULLABLE collection);
 LILV_API unsigned
 lilv_uis_size(const LilvUIs* LILV_NULLABLE collection);
 
+/**
+   Return an iterator to the first element of `collection`.
+
+   The iterator points into the storage of the collection, so it is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_uis_begin(const LilvUIs* LILV_NULLABLE collection);
 
@@ -451,6 +509,15 @@ LILV_API const LilvUI* LILV_UNSPECIFIED
 lilv_uis_get(const LilvUIs* LILV_UNSPECIFIED collection,
              const LilvIter* LILV_NULLABLE   i);
 
+LILV_API const LilvUI* LILV_NULLABLE
+lilv_uis_get_at(const LilvUIs* LILV_NULLABLE collection, unsigned index);
+
+/**
+   Return an iterator to the element after `i` in `collection`.
+
+   Like the iterator returned by lilv_uis_begin(), this is invalidated by any
+   change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_uis_next(const LilvUIs* LILV_UNSPECIFIED collection,
               LilvIter* LILV_NULLABLE         i);
@@ -479,6 +546,12 @@ lilv_nodes_free(LilvNodes* LILV_NULLABLE collection);
 LILV_API unsigned
 lilv_nodes_size(const LilvNodes* LILV_NULLABLE collection);
 
+/**
+   Return an iterator to the first element of `collection`.
+
+   The iterator points into the storage of the collection, so it is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_nodes_begin(const LilvNodes* LILV_NULLABLE collection);
 
@@ -486,6 +559,15 @@ LILV_API const LilvNode* LILV_UNSPECIFIED
 lilv_nodes_get(const LilvNodes* LILV_UNSPECIFIED collection,
                const LilvIter* LILV_NULLABLE     i);
 
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_nodes_get_at(const LilvNodes* LILV_NULLABLE collection, unsigned index);
+
+/**
+   Return an iterator to the element after `i` in `collection`.
+
+   Like the iterator returned by lilv_nodes_begin(), this is invalidated by any
+   change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_nodes_next(const LilvNodes* LILV_UNSPECIFIED collection,
                 LilvIter* LILV_NULLABLE           i);
@@ -499,6 +581,10 @@ lilv_nodes_get_first(const LilvNodes* LILV_NULLABLE collection);
 
 /**
    Return whether `values` contains `value`.
+
+   Nodes are not sorted, so this is a linear search for small collections.
+   Larger collections keep a hash of their values, which makes this a
+   constant time lookup.
 */
 LILV_API bool
 lilv_nodes_contains(const LilvNodes* LILV_NONNULL nodes,
@@ -513,9 +599,26 @@ lilv_nodes_merge(const LilvNodes* LILV_NULLABLE a,
 
 /* Plugins */
 
+/**
+   Free a collection of plugins.
+
+   This must only be called on collections returned by functions that
+   document it, like lilv_world_get_supported_plugins(), and never on the
+   collection of all plugins owned by the world.  It does not free the
+   plugins themselves.
+*/
+LILV_API void
+lilv_plugins_free(LilvPlugins* LILV_NULLABLE collection);
+
 LILV_API unsigned
 lilv_plugins_size(const LilvPlugins* LILV_NULLABLE collection);
 
+/**
+   Return an iterator to the first element of `collection`.
+
+   The iterator points into the storage of the collection, so it is
+   invalidated by any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_plugins_begin(const LilvPlugins* LILV_NULLABLE collection);
 
@@ -523,6 +626,16 @@ LILV_API const LilvPlugin* LILV_UNSPECIFIED
 lilv_plugins_get(const LilvPlugins* LILV_UNSPECIFIED collection,
                  const LilvIter* LILV_NULLABLE       i);
 
+LILV_API const LilvPlugin* LILV_NULLABLE
+lilv_plugins_get_at(const LilvPlugins* LILV_NULLABLE collection,
+                    unsigned                         index);
+
+/**
+   Return an iterator to the element after `i` in `collection`.
+
+   Like the iterator returned by lilv_plugins_begin(), this is invalidated by
+   any change to the collection.
+*/
 LILV_API LilvIter* LILV_NULLABLE
 lilv_plugins_next(const LilvPlugins* LILV_UNSPECIFIED collection,
                   LilvIter* LILV_NULLABLE             i);
@@ -563,6 +676,32 @@ lilv_plugins_get_by_uri(const LilvPlugins* LILV_NONNULL plugins,
 LILV_API LilvWorld* LILV_ALLOCATED
 lilv_world_new(void);
 
+/**
+   Set a directory for caching discovery data.
+
+   If this is set to a directory path, then lilv_world_load_all() will save a
+   compact snapshot of every manifest and specification data file it reads to
+   a cache file in this directory, keyed by file modification time and size.
+   Subsequent loads will replay the data for any unchanged files from the
+   cache, and only parse files that have been changed or added.  The directory
+   is created if it doesn't exist.
+
+   The cache is disabled by default.
+*/
+#define LILV_OPTION_CACHE_DIR "http://drobilla.net/ns/lilv#cache-dir"
+
+/**
+   Set the number of threads used to read data files during discovery.
+
+   If this is set to an integer greater than 1, then lilv_world_load_all() will
+   read manifest and specification data files with this many threads, then
+   load the results into the world in the same order they would be read with
+   a single thread.  Plugins, version replacement, and everything else loaded
+   are exactly the same as with the default of a single thread.
+*/
+#define LILV_OPTION_DISCOVERY_THREADS \
+  "http://drobilla.net/ns/lilv#discovery-threads"
+
 /**
    Enable/disable dynamic manifest support.
 
@@ -580,6 +719,21 @@ lilv_world_new(void);
 */
 #define LILV_OPTION_FILTER_LANG "http://drobilla.net/ns/lilv#filter-lang"
 
+/**
+   Enable/disable lazy loading of specifications.
+
+   If this is true, then specification data files aren't loaded with the
+   manifests, only recorded along with the namespace of the specification.
+   The data for a specification is loaded the first time a query involves a
+   URI in its namespace, either directly (like lilv_world_find_nodes()) or
+   through an accessor (like lilv_plugin_get_value() or lilv_port_get()), and
+   all specifications are loaded the first time plugin classes are needed.  This
+   reduces load time and memory consumption for hosts that only use plugin
+   data.  Lazy loading is disabled by default.
+*/
+#define LILV_OPTION_LAZY_SPECIFICATIONS \
+  "http://drobilla.net/ns/lilv#lazy-specifications"
+
 /**
    Set application-specific LANG.
 
@@ -596,6 +750,23 @@ lilv_world_new(void);
 */
 #define LILV_OPTION_LV2_PATH "http://drobilla.net/ns/lilv#lv2-path"
 
+/**
+   Enable/disable memory-mapped reading of data files.
+
+   If this is true, then data files are mapped into memory and parsed from
+   there where possible, which avoids the overhead of reading them with many
+   small system calls.  Files that can't be mapped are read normally.  This
+   applies to files read into the discovery cache as well.  This is disabled
+   by default, and only has an effect on systems that support it.
+
+   Note that if a data file is truncated by another process while it's being
+   parsed from memory, the system may raise SIGBUS and terminate the program.
+   Lilv checks the size of each file after mapping it to avoid this in most
+   cases, but can't completely prevent it, so this should only be enabled by
+   hosts that don't load data files that may be rewritten in place.
+*/
+#define LILV_OPTION_MMAP "http://drobilla.net/ns/lilv#mmap"
+
 /**
    Enable/disable object-first index for queries with subject wildcards.
 
@@ -608,6 +779,30 @@ lilv_world_new(void);
 */
 #define LILV_OPTION_OBJECT_INDEX "http://drobilla.net/ns/lilv#object-index"
 
+/**
+   Set the maximum number of query results to cache.
+
+   If this is set to an integer greater than zero, then lilv_world_get()
+   remembers the results of up to this many queries, so repeating a query is
+   much faster.  Cached results are discarded whenever data is loaded or
+   unloaded, or the language is changed.  The cache is disabled by default,
+   and can be disabled again by setting this to zero.  The effectiveness of
+   the cache can be checked with lilv_world_get_stats().
+*/
+#define LILV_OPTION_QUERY_CACHE_SIZE \
+  "http://drobilla.net/ns/lilv#query-cache-size"
+
+/**
+   Enable/disable collection of load statistics.
+
+   If this is true, then the world records how much data was loaded from each
+   bundle and file, and how long it took, which can be retrieved with
+   lilv_world_get_stats().  This is useful for finding bundles that make
+   loading slow.  Statistics are disabled by default, since timing every file
+   adds some overhead.
+*/
+#define LILV_OPTION_STATS "http://drobilla.net/ns/lilv#stats"
+
 /**
    Set an option for `world`.
 
@@ -617,11 +812,17 @@ lilv_world_new(void);
 
    Currently recognized options:
 
+   - #LILV_OPTION_CACHE_DIR
+   - #LILV_OPTION_DISCOVERY_THREADS
    - #LILV_OPTION_DYN_MANIFEST
    - #LILV_OPTION_FILTER_LANG
    - #LILV_OPTION_LANG
+   - #LILV_OPTION_LAZY_SPECIFICATIONS
    - #LILV_OPTION_LV2_PATH
+   - #LILV_OPTION_MMAP
    - #LILV_OPTION_OBJECT_INDEX
+   - #LILV_OPTION_QUERY_CACHE_SIZE
+   - #LILV_OPTION_STATS
 */
 LILV_API void
 lilv_world_set_option(LilvWorld* LILV_NONNULL       world,
@@ -653,6 +854,81 @@ lilv_world_free(LilvWorld* LILV_NULLABLE world);
 LILV_API void
 lilv_world_load_all(LilvWorld* LILV_NONNULL world);
 
+/**
+   Rescan the LV2 path for bundles that have changed since they were loaded.
+
+   This updates the world to reflect the bundles that are currently installed,
+   without reloading everything like calling lilv_world_load_all() again would.
+   New bundles are loaded, bundles whose directory or manifest has been
+   modified are reloaded, and bundles that have been removed are unloaded,
+   just as with lilv_world_load_bundle() and lilv_world_unload_bundle().
+   Only bundles found in the LV2 path are considered, so bundles loaded
+   explicitly with lilv_world_load_bundle() are left untouched.
+
+   Since specification data isn't unloaded with its bundle, changes to the
+   data files of a specification that has already been loaded are not picked
+   up.
+
+   This should be called after lilv_world_load_all(), for example to pick up
+   plugins that were installed while the host was running.
+
+   @return The number of bundles that were loaded, reloaded, or unloaded.
+*/
+LILV_API unsigned
+lilv_world_rescan(LilvWorld* LILV_NONNULL world);
+
+/**
+   Start watching the LV2 path for changes to installed bundles.
+
+   This watches every existing directory in the LV2 path, and every bundle in
+   those directories, for changes.  Changes are queued as they happen, and only
+   applied to the world by lilv_world_apply_changes(), so the host controls
+   exactly when the world is modified.  Unlike lilv_world_rescan(), this
+   doesn't scan the whole path, and also notices changes to data files within
+   a bundle.
+
+   This should be called after lilv_world_load_all().  Watching is currently
+   only supported on Linux (with inotify).
+
+   @return Zero on success, or non-zero if watching isn't supported or failed.
+*/
+LILV_API int
+lilv_world_watch(LilvWorld* LILV_NONNULL world);
+
+/**
+   Return a file descriptor that becomes readable when changes are pending.
+
+   This can be used to wait for changes in an event loop with a function like
+   poll(), and call lilv_world_apply_changes() when it becomes readable.  The
+   descriptor is owned by the world and must not be read from or closed.
+
+   @return A file descriptor, or -1 if the world isn't being watched.
+*/
+LILV_API int
+lilv_world_get_watch_fd(const LilvWorld* LILV_NONNULL world);
+
+/**
+   Apply any pending changes to installed bundles.
+
+   This never blocks.  Each bundle with pending changes is loaded if it's new,
+   reloaded if it has changed, or unloaded if it has been removed, just as
+   with lilv_world_rescan().  Bundles are updated in the order their changes
+   were first noticed.  Many changes to the same bundle (like writing several
+   files) are coalesced, so a bundle is reloaded at most once per call.
+
+   Usually, only the changed bundles are touched.  However, if change events
+   were lost (for example, because the system's event queue overflowed), then
+   the whole LV2 path is scanned with lilv_world_rescan() instead, so this can
+   occasionally be as expensive as a rescan.
+
+   Like loading or unloading bundles, this modifies the world, so must not be
+   called concurrently with any other use of it.
+
+   @return The number of bundles that were loaded, reloaded, or unloaded.
+*/
+LILV_API unsigned
+lilv_world_apply_changes(LilvWorld* LILV_NONNULL world);
+
 /**
    Load a specific bundle.
 
@@ -675,7 +951,9 @@ lilv_world_load_bundle(LilvWorld* LILV_NONNULL      world,
 
    This is for hosts that explicitly load specific bundles, its use is not
    necessary when using lilv_world_load_all().  This function parses the
-   specifications and adds them to the model.
+   specifications and adds them to the model, unless
+   #LILV_OPTION_LAZY_SPECIFICATIONS is enabled, in which case they are parsed
+   when first needed.
 */
 LILV_API void
 lilv_world_load_specifications(LilvWorld* LILV_NONNULL world);
@@ -696,7 +974,9 @@ lilv_world_load_plugin_classes(LilvWorld* LILV_NONNULL world);
    This unloads statements loaded by lilv_world_load_bundle().  Note that this
    is not necessarily all information loaded from the bundle.  If any resources
    have been separately loaded with lilv_world_load_resource(), they must be
-   separately unloaded with lilv_world_unload_resource().
+   separately unloaded with lilv_world_unload_resource().  The data of any
+   specifications in the bundle that have been loaded is also kept, and isn't
+   read again if the bundle is loaded again.
 */
 LILV_API int
 lilv_world_unload_bundle(LilvWorld* LILV_NONNULL          world,
@@ -758,6 +1038,86 @@ lilv_world_get_plugin_classes(const LilvWorld* LILV_NONNULL world);
 LILV_API const LilvPlugins* LILV_NONNULL
 lilv_world_get_all_plugins(const LilvWorld* LILV_NONNULL world);
 
+/**
+   Get a plugin by URI string.
+
+   This is equivalent to calling lilv_plugins_get_by_uri() with the result of
+   lilv_world_get_all_plugins(), but takes a URI string so no node needs to be
+   allocated.
+
+   @return The plugin, which is owned by `world`, or NULL if no plugin with
+   `uri` is found.
+*/
+LILV_API const LilvPlugin* LILV_NULLABLE
+lilv_world_get_plugin_by_uri(const LilvWorld* LILV_NONNULL world,
+                             const char* LILV_NONNULL      uri);
+
+/**
+   Get all plugins that only require features in a feature set.
+
+   This checks every plugin with lilv_plugin_is_supported(), so it loads the
+   data of every plugin the first time it is called.
+
+   @return A new collection of plugins owned by `world`, which must be freed by
+   the caller with lilv_plugins_free().
+*/
+LILV_API LilvPlugins* LILV_ALLOCATED
+lilv_world_get_supported_plugins(LilvWorld* LILV_NONNULL            world,
+                                 const LilvFeatureSet* LILV_NONNULL features);
+
+/**
+   Flags that control how lilv_world_search_plugins() matches plugins.
+
+   If none of the field flags are given, then all fields are searched.
+*/
+typedef enum {
+  LILV_SEARCH_NAME      = 1U << 0U, /**< Search plugin names. */
+  LILV_SEARCH_AUTHOR    = 1U << 1U, /**< Search plugin author names. */
+  LILV_SEARCH_CLASS     = 1U << 2U, /**< Search plugin class labels. */
+  LILV_SEARCH_URI       = 1U << 3U, /**< Search plugin URIs. */
+  LILV_SEARCH_SUBSTRING = 1U << 4U, /**< Match words anywhere in words. */
+  LILV_SEARCH_LOAD      = 1U << 5U, /**< Load all plugin data to search. */
+} LilvSearchFlag;
+
+/**
+   A plugin found by lilv_world_search_plugins().
+*/
+typedef struct {
+  const LilvPlugin* plugin; /**< Matching plugin, owned by the world. */
+  unsigned          score;  /**< Relevance of match, higher is better. */
+} LilvSearchResult;
+
+/**
+   Search for plugins by text.
+
+   The query is split into words, and a plugin matches if every word is the
+   start of a word in its name, author name, class labels (including those of
+   parent classes), or URI.  Matching ignores ASCII case.  Whole words match
+   better than prefixes, and names match better than classes, which match
+   better than authors and URIs.
+
+   The first search builds an index, which is kept up to date as bundles are
+   loaded and unloaded, so later searches are fast.  By default, only the data
+   that is already loaded is searched, so a plugin whose data hasn't been
+   loaded yet can only be found by what's in its manifest (like its URI), until
+   it's loaded by some other call.  If #LILV_SEARCH_LOAD is given, then the
+   data of every plugin is loaded first, so everything can be found, but the
+   first such search is as slow as loading every plugin.
+
+   @param world The world.
+   @param query Words to search for, separated by spaces or punctuation.
+   @param flags Fields to search and other options (#LilvSearchFlag).
+   @param n_results Set to the number of results.
+
+   @return An array of `n_results` results, ordered by decreasing score, which
+   must be freed by the caller with lilv_free(), or NULL if nothing matches.
+*/
+LILV_API LilvSearchResult* LILV_ALLOCATED
+lilv_world_search_plugins(LilvWorld* LILV_NONNULL  world,
+                          const char* LILV_NONNULL query,
+                          uint32_t                 flags,
+                          unsigned* LILV_NONNULL   n_results);
+
 /**
    Find nodes matching a triple pattern.
 
@@ -771,6 +1131,38 @@ lilv_world_find_nodes(LilvWorld* LILV_NONNULL          world,
                       const LilvNode* LILV_UNSPECIFIED predicate,
                       const LilvNode* LILV_NULLABLE    object);
 
+/**
+   Function for visiting nodes.
+
+   @param user_data The user_data passed to the visiting function.
+   @param node A node that is only valid during this call, which must not be
+   freed.  It can be copied with lilv_node_duplicate().
+*/
+typedef void (*LilvNodeFunc)(void* LILV_UNSPECIFIED       user_data,
+                             const LilvNode* LILV_NONNULL node);
+
+/**
+   Visit the nodes matching a triple pattern.
+
+   This visits the same nodes as lilv_world_find_nodes() would return
+   (including the selection of literals by language, and dropping their
+   language tags), but without allocating a collection or a LilvNode for each
+   result, which is much faster when the results only need to be read once.
+   URIs, blank nodes, and literals that are already normalized are visited
+   without copying.  A literal with a language tag or unknown datatype is
+   normalized into a new node first, like the nodes returned by
+   lilv_world_find_nodes(), so visiting such literals still allocates.
+
+   @return The number of nodes visited.
+*/
+LILV_API unsigned
+lilv_world_foreach_match(LilvWorld* LILV_NONNULL          world,
+                         const LilvNode* LILV_NULLABLE    subject,
+                         const LilvNode* LILV_UNSPECIFIED predicate,
+                         const LilvNode* LILV_NULLABLE    object,
+                         LilvNodeFunc LILV_NONNULL        func,
+                         void* LILV_UNSPECIFIED           user_data);
+
 /**
    Find a single node that matches a pattern.
 
@@ -786,6 +1178,50 @@ lilv_world_get(LilvWorld* LILV_NONNULL       world,
                const LilvNode* LILV_NONNULL  predicate,
                const LilvNode* LILV_NULLABLE object);
 
+/**
+   Find a single shared node that matches a pattern.
+
+   This is like lilv_world_get(), but returns a node owned by the world, so
+   repeatedly getting the same value doesn't allocate anything.
+
+   Shared nodes are not released when the bundle they came from is unloaded,
+   only by lilv_world_free(), so a world that loads and unloads many
+   different bundles will accumulate every shared value it has returned.
+
+   @return The first matching node, which is valid until the world is freed
+   and must not be freed by the caller, or NULL if no matches are found.
+*/
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_world_get_shared(LilvWorld* LILV_NONNULL       world,
+                      const LilvNode* LILV_NULLABLE subject,
+                      const LilvNode* LILV_NONNULL  predicate,
+                      const LilvNode* LILV_NULLABLE object);
+
+/**
+   Get a single value for each of several properties of a subject.
+
+   This is equivalent to calling lilv_world_get() with a NULL object for every
+   predicate, but reads the description of the subject only once (for up to
+   16 predicates at a time), so it is significantly faster for getting many
+   properties.  Values are selected by language in the same way.
+
+   @param world The world.
+   @param subject The subject to get the properties of.
+   @param n_predicates The number of predicates and values.
+   @param predicates The predicates, which may contain NULL to skip a value.
+   @param values Set to a new node for each predicate that has a value, or
+   NULL.  Each value must be freed by the caller with lilv_node_free().
+
+   @return The number of values found.
+*/
+LILV_API unsigned
+lilv_world_get_values(
+  LilvWorld* LILV_NONNULL                           world,
+  const LilvNode* LILV_NONNULL                      subject,
+  unsigned                                          n_predicates,
+  const LilvNode* LILV_NULLABLE const* LILV_NONNULL predicates,
+  LilvNode* LILV_NULLABLE* LILV_NONNULL             values);
+
 /**
    Return true iff a statement matching a certain pattern exists.
 
@@ -815,6 +1251,76 @@ LILV_API LilvNode* LILV_NULLABLE
 lilv_world_get_symbol(LilvWorld* LILV_NONNULL      world,
                       const LilvNode* LILV_NONNULL subject);
 
+/**
+   Statistics about loading data.
+
+   Times are in nanoseconds, and include time spent replaying files from the
+   discovery cache, which are counted as loaded files without any bytes.
+*/
+typedef struct {
+  uint64_t n_files;           /**< Number of files loaded. */
+  uint64_t n_bytes;           /**< Number of bytes parsed. */
+  uint64_t n_statements;      /**< Number of statements added. */
+  uint64_t parse_time;        /**< Time spent loading files. */
+  uint64_t version_time;      /**< Time spent comparing plugin versions. */
+  uint64_t dyn_manifest_time; /**< Time spent loading dynamic manifests. */
+} LilvLoadStats;
+
+/**
+   Statistics about everything loaded by a world.
+*/
+typedef struct {
+  LilvLoadStats total;            /**< Totals for all loaded files. */
+  uint64_t      n_plugin_loads;   /**< Number of plugins loaded on demand. */
+  uint64_t      plugin_load_time; /**< Time spent loading plugins. */
+  uint64_t      n_query_hits;     /**< Queries answered by the query cache. */
+  uint64_t      n_query_misses;   /**< Queries added to the query cache. */
+} LilvWorldStats;
+
+/**
+   Function for visiting the load statistics of a bundle or file.
+
+   @param user_data The user_data passed to the visiting function.
+   @param uri The URI of the bundle or file.
+   @param stats The statistics for the bundle or file.
+*/
+typedef void (*LilvLoadStatsFunc)(void* LILV_UNSPECIFIED            user_data,
+                                  const LilvNode* LILV_NONNULL      uri,
+                                  const LilvLoadStats* LILV_NONNULL stats);
+
+/**
+   Get world-wide load statistics.
+
+   Statistics are only collected if #LILV_OPTION_STATS is enabled, otherwise
+   everything is zero, except the query cache counters which are always
+   collected if #LILV_OPTION_QUERY_CACHE_SIZE is set.
+
+   @return Zero on success, or non-zero if statistics are disabled.
+*/
+LILV_API int
+lilv_world_get_stats(const LilvWorld* LILV_NONNULL world,
+                     LilvWorldStats* LILV_NONNULL  stats);
+
+/**
+   Visit the load statistics of every loaded bundle.
+
+   The statistics of a bundle include every file loaded from within it, and
+   the time spent comparing versions and loading dynamic manifests when it was
+   loaded.
+*/
+LILV_API void
+lilv_world_get_bundle_stats(const LilvWorld* LILV_NONNULL world,
+                            LilvLoadStatsFunc LILV_NONNULL func,
+                            void* LILV_UNSPECIFIED         user_data);
+
+/**
+   Visit the load statistics of every loaded file.
+*/
+LILV_API void
+lilv_world_get_file_stats(const LilvWorld* LILV_NONNULL world,
+                          LilvLoadStatsFunc LILV_NONNULL func,
+                          void* LILV_UNSPECIFIED         user_data);
+
 /**
    @}
    @defgroup lilv_plugin Plugins
@@ -908,12 +1414,33 @@ lilv_plugin_get_library_uri(const LilvPlugin* LILV_NONNULL plugin);
 LILV_API LilvNode* LILV_NULLABLE
 lilv_plugin_get_name(const LilvPlugin* LILV_NONNULL plugin);
 
+/**
+   Get the shared name of `plugin`.
+
+   This is like lilv_plugin_get_name(), but returns a node owned by the world,
+   which is valid until the world is freed and must not be freed by the
+   caller.  See lilv_world_get_shared() for details.
+*/
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_plugin_get_shared_name(const LilvPlugin* LILV_NONNULL plugin);
+
 /**
    Get the class this plugin belongs to (like "Filters" or "Effects").
 */
 LILV_API const LilvPluginClass* LILV_NONNULL
 lilv_plugin_get_class(const LilvPlugin* LILV_NONNULL plugin);
 
+/**
+   Return true if a plugin is an instance of a plugin class.
+
+   This is true if any type of the plugin is `plugin_class` or a transitive
+   subclass of it, so, for example, a lowpass plugin is also a filter.  This
+   is a constant-time check after the first call for a plugin.
+*/
+LILV_API bool
+lilv_plugin_is_a(const LilvPlugin* LILV_NONNULL      plugin,
+                 const LilvPluginClass* LILV_NONNULL plugin_class);
+
 /**
    Get a value associated with the plugin in a plugin's data files.
 
@@ -932,6 +1459,35 @@ LILV_API LilvNodes* LILV_NULLABLE
 lilv_plugin_get_value(const LilvPlugin* LILV_NONNULL plugin,
                       const LilvNode* LILV_NONNULL   predicate);
 
+/**
+   Visit the values of a plugin property without allocating a collection.
+
+   This visits the same nodes that lilv_plugin_get_value() would return, see
+   lilv_world_foreach_match() for details.
+
+   @return The number of nodes visited.
+*/
+LILV_API unsigned
+lilv_plugin_foreach_value(const LilvPlugin* LILV_NONNULL plugin,
+                          const LilvNode* LILV_NONNULL   predicate,
+                          LilvNodeFunc LILV_NONNULL      func,
+                          void* LILV_UNSPECIFIED         user_data);
+
+/**
+   Get a single value for each of several properties of a plugin.
+
+   This loads the plugin if necessary, then gets values like
+   lilv_world_get_values().
+
+   @return The number of values found.
+*/
+LILV_API unsigned
+lilv_plugin_get_values(
+  const LilvPlugin* LILV_NONNULL                    plugin,
+  unsigned                                          n_predicates,
+  const LilvNode* LILV_NULLABLE const* LILV_NONNULL predicates,
+  LilvNode* LILV_NULLABLE* LILV_NONNULL             values);
+
 /**
    Return whether a feature is supported by a plugin.
 
@@ -984,6 +1540,17 @@ lilv_plugin_get_required_features(const LilvPlugin* LILV_NONNULL plugin);
 LILV_API LilvNodes* LILV_NULLABLE
 lilv_plugin_get_optional_features(const LilvPlugin* LILV_NONNULL plugin);
 
+/**
+   Return true if a feature set contains every feature required by a plugin.
+
+   The features of each plugin are loaded once, so repeated checks against
+   different feature sets don't query the plugin data or allocate.  This
+   returns false if the feature set was created in a different world.
+*/
+LILV_API bool
+lilv_plugin_is_supported(const LilvPlugin* LILV_NONNULL     plugin,
+                         const LilvFeatureSet* LILV_NONNULL features);
+
 /**
    Return whether or not a plugin provides a specific extension data.
 */
@@ -1027,6 +1594,101 @@ lilv_plugin_get_port_ranges_float(const LilvPlugin* LILV_NONNULL plugin,
                                   float* LILV_NULLABLE           max_values,
                                   float* LILV_NULLABLE           def_values);
 
+/**
+   Get shared arrays of the port ranges for all ports.
+
+   This is like lilv_plugin_get_port_ranges_float(), but sets each of
+   `min_values`, `max_values` and `def_values` that isn't NULL to point to an
+   array owned by the plugin, instead of copying values.  The arrays are valid
+   until the plugin's bundle is unloaded, and are set to NULL if the plugin
+   has no ports.
+*/
+LILV_API void
+lilv_plugin_get_port_range_arrays(
+  const LilvPlugin* LILV_NONNULL            plugin,
+  const float* LILV_NULLABLE* LILV_NULLABLE min_values,
+  const float* LILV_NULLABLE* LILV_NULLABLE max_values,
+  const float* LILV_NULLABLE* LILV_NULLABLE def_values);
+
+/**
+   The direction of a port, from the plugin's perspective.
+*/
+typedef enum {
+  LILV_PORT_DIRECTION_UNKNOWN, /**< Neither lv2:InputPort nor lv2:OutputPort. */
+  LILV_PORT_DIRECTION_INPUT,   /**< An lv2:InputPort. */
+  LILV_PORT_DIRECTION_OUTPUT,  /**< An lv2:OutputPort. */
+} LilvPortDirection;
+
+/**
+   The type of data a port carries, as given by its class.
+*/
+typedef enum {
+  LILV_PORT_DATA_UNKNOWN, /**< Unknown or unsupported data type. */
+  LILV_PORT_DATA_AUDIO,   /**< An lv2:AudioPort. */
+  LILV_PORT_DATA_CONTROL, /**< An lv2:ControlPort. */
+  LILV_PORT_DATA_CV,      /**< An lv2:CVPort. */
+  LILV_PORT_DATA_ATOM,    /**< An atom:AtomPort. */
+  LILV_PORT_DATA_EVENT,   /**< A (deprecated) ev:EventPort. */
+} LilvPortDataType;
+
+/**
+   Flags for well-known port properties.
+
+   These correspond to values of lv2:portProperty from the LV2 core and port
+   properties specifications.
+*/
+typedef enum {
+  LILV_PORT_CONNECTION_OPTIONAL = 1U << 0U,  /**< lv2:connectionOptional. */
+  LILV_PORT_ENUMERATION         = 1U << 1U,  /**< lv2:enumeration. */
+  LILV_PORT_INTEGER             = 1U << 2U,  /**< lv2:integer. */
+  LILV_PORT_IS_SIDE_CHAIN       = 1U << 3U,  /**< lv2:isSideChain. */
+  LILV_PORT_REPORTS_LATENCY     = 1U << 4U,  /**< lv2:reportsLatency. */
+  LILV_PORT_SAMPLE_RATE         = 1U << 5U,  /**< lv2:sampleRate. */
+  LILV_PORT_TOGGLED             = 1U << 6U,  /**< lv2:toggled. */
+  LILV_PORT_CAUSES_ARTIFACTS    = 1U << 7U,  /**< pprops:causesArtifacts. */
+  LILV_PORT_CONTINUOUS_CV       = 1U << 8U,  /**< pprops:continuousCV. */
+  LILV_PORT_DISCRETE_CV         = 1U << 9U,  /**< pprops:discreteCV. */
+  LILV_PORT_EXPENSIVE           = 1U << 10U, /**< pprops:expensive. */
+  LILV_PORT_HAS_STRICT_BOUNDS   = 1U << 11U, /**< pprops:hasStrictBounds. */
+  LILV_PORT_LOGARITHMIC         = 1U << 12U, /**< pprops:logarithmic. */
+  LILV_PORT_NOT_AUTOMATIC       = 1U << 13U, /**< pprops:notAutomatic. */
+  LILV_PORT_NOT_ON_GUI          = 1U << 14U, /**< pprops:notOnGUI. */
+  LILV_PORT_TRIGGER             = 1U << 15U, /**< pprops:trigger. */
+} LilvPortProperty;
+
+/**
+   A summary of the description of a port.
+*/
+typedef struct {
+  uint32_t          index;       /**< Index of the port. */
+  const char*       symbol;      /**< Symbol of the port. */
+  LilvPortDirection direction;   /**< Direction of the port. */
+  LilvPortDataType  data_type;   /**< Type of data the port carries. */
+  float             def;         /**< Default value, or NAN. */
+  float             min;         /**< Minimum value, or NAN. */
+  float             max;         /**< Maximum value, or NAN. */
+  uint32_t          properties;  /**< Known properties (#LilvPortProperty). */
+  const LilvNode*   designation; /**< The lv2:designation, or NULL. */
+  const LilvNode*   buffer_type; /**< The atom:bufferType, or NULL. */
+} LilvPortInfo;
+
+/**
+   Get a table that summarizes the descriptions of all ports.
+
+   This is a convenience method for hosts that need the basic description of
+   every port, and is significantly faster than calling lilv_port_is_a(),
+   lilv_port_get_range(), lilv_port_has_property(), and so on for every port.
+   The table is built when it is first requested, and is cached for later
+   calls.
+
+   @return An array of N records, where N is the value returned by
+   lilv_plugin_get_num_ports() for this plugin, with array index corresponding
+   to port index.  The table is owned by the plugin, and is valid until the
+   plugin's bundle is unloaded.  NULL is returned if the plugin has no ports.
+*/
+LILV_API const LilvPortInfo* LILV_NULLABLE
+lilv_plugin_get_port_table(const LilvPlugin* LILV_NONNULL plugin);
+
 /**
    Get the number of ports on this plugin that are members of some class(es).
 
@@ -1080,14 +1742,21 @@ lilv_plugin_get_port_by_index(const LilvPlugin* LILV_NONNULL plugin,
 
 /**
    Get a port on `plugin` by `symbol`.
-
-   Note this function is slower than lilv_plugin_get_port_by_index(),
-   especially on plugins with a very large number of ports.
 */
 LILV_API const LilvPort* LILV_NULLABLE
 lilv_plugin_get_port_by_symbol(const LilvPlugin* LILV_NONNULL plugin,
                                const LilvNode* LILV_NONNULL   symbol);
 
+/**
+   Get a port on `plugin` by a `symbol` string.
+
+   This is equivalent to lilv_plugin_get_port_by_symbol(), but avoids the need
+   to allocate a node when the symbol is only available as a string.
+*/
+LILV_API const LilvPort* LILV_NULLABLE
+lilv_plugin_get_port_by_symbol_string(const LilvPlugin* LILV_NONNULL plugin,
+                                      const char* LILV_NONNULL       symbol);
+
 /**
    Get a port on `plugin` by its lv2:designation.
 
@@ -1112,6 +1781,16 @@ lilv_plugin_get_port_by_designation(const LilvPlugin* LILV_NONNULL plugin,
 LILV_API LilvNode* LILV_NULLABLE
 lilv_plugin_get_project(const LilvPlugin* LILV_NONNULL plugin);
 
+/**
+   Get the project the plugin is a part of as a shared node.
+
+   This is like lilv_plugin_get_project(), but returns a node owned by the
+   world, which is valid until the world is freed and must not be freed by the
+   caller.  See lilv_world_get_shared() for details.
+*/
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_plugin_get_shared_project(const LilvPlugin* LILV_NONNULL plugin);
+
 /**
    Get the full name of the plugin's author.
 
@@ -1215,6 +1894,16 @@ lilv_port_get_value(const LilvPlugin* LILV_NONNULL plugin,
                     const LilvPort* LILV_NONNULL   port,
                     const LilvNode* LILV_NONNULL   predicate);
 
+/**
+   Port analog of lilv_plugin_foreach_value().
+*/
+LILV_API unsigned
+lilv_port_foreach_value(const LilvPlugin* LILV_NONNULL plugin,
+                        const LilvPort* LILV_NONNULL   port,
+                        const LilvNode* LILV_NONNULL   predicate,
+                        LilvNodeFunc LILV_NONNULL      func,
+                        void* LILV_UNSPECIFIED         user_data);
+
 /**
    Get a single property value of a port.
 
@@ -1227,6 +1916,32 @@ lilv_port_get(const LilvPlugin* LILV_NONNULL plugin,
               const LilvPort* LILV_NONNULL   port,
               const LilvNode* LILV_NONNULL   predicate);
 
+/**
+   Get a single shared property value of a port.
+
+   This is like lilv_port_get(), but returns a node owned by the world, which
+   is valid until the world is freed and must not be freed by the caller.
+   See lilv_world_get_shared() for details.
+*/
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_port_get_shared(const LilvPlugin* LILV_NONNULL plugin,
+                     const LilvPort* LILV_NONNULL   port,
+                     const LilvNode* LILV_NONNULL   predicate);
+
+/**
+   Port analog of lilv_plugin_get_values().
+
+   This is useful for getting many properties of a port at once, for example
+   the name, comment, unit, and so on to describe it in a user interface.
+*/
+LILV_API unsigned
+lilv_port_get_values(
+  const LilvPlugin* LILV_NONNULL                    plugin,
+  const LilvPort* LILV_NONNULL                      port,
+  unsigned                                          n_predicates,
+  const LilvNode* LILV_NULLABLE const* LILV_NONNULL predicates,
+  LilvNode* LILV_NULLABLE* LILV_NONNULL             values);
+
 /**
    Return the LV2 port properties of a port.
 */
@@ -1284,6 +1999,17 @@ LILV_API LilvNode* LILV_NULLABLE
 lilv_port_get_name(const LilvPlugin* LILV_NONNULL plugin,
                    const LilvPort* LILV_NONNULL   port);
 
+/**
+   Get the shared name of a port.
+
+   This is like lilv_port_get_name(), but returns a node owned by the world,
+   which is valid until the world is freed and must not be freed by the
+   caller.  See lilv_world_get_shared() for details.
+*/
+LILV_API const LilvNode* LILV_NULLABLE
+lilv_port_get_shared_name(const LilvPlugin* LILV_NONNULL plugin,
+                          const LilvPort* LILV_NONNULL   port);
+
 /**
    Get all the classes of a port.
 
@@ -1338,6 +2064,41 @@ LILV_API LilvScalePoints* LILV_NULLABLE
 lilv_port_get_scale_points(const LilvPlugin* LILV_NONNULL plugin,
                            const LilvPort* LILV_NONNULL   port);
 
+/**
+   Get the scale points of a port sorted by value.
+
+   This is like lilv_port_get_scale_points(), but the returned collection is
+   owned by the plugin and must not be freed.  Scale points are sorted by
+   numeric value, and are loaded once and reused by later calls.
+
+   @return The scale points of `port`, or NULL if it has none.
+*/
+LILV_API const LilvScalePoints* LILV_NULLABLE
+lilv_port_get_sorted_scale_points(const LilvPlugin* LILV_NONNULL plugin,
+                                  const LilvPort* LILV_NONNULL   port);
+
+/**
+   Get the scale point of a port with a given numeric value.
+
+   @return The scale point with exactly `value`, or NULL.  The returned point
+   is owned by the plugin and must not be freed.
+*/
+LILV_API const LilvScalePoint* LILV_NULLABLE
+lilv_port_get_scale_point_by_value(const LilvPlugin* LILV_NONNULL plugin,
+                                   const LilvPort* LILV_NONNULL   port,
+                                   float                          value);
+
+/**
+   Get the scale point of a port with a given label.
+
+   @return The first scale point labeled `label`, or NULL.  The returned
+   point is owned by the plugin and must not be freed.
+*/
+LILV_API const LilvScalePoint* LILV_NULLABLE
+lilv_port_get_scale_point_by_label(const LilvPlugin* LILV_NONNULL plugin,
+                                   const LilvPort* LILV_NONNULL   port,
+                                   const char* LILV_NONNULL       label);
+
 /**
    @}
    @defgroup lilv_state Plugin State
@@ -1765,6 +2526,62 @@ LILV_API LilvPluginClasses* LILV_ALLOCATED
 lilv_plugin_class_get_children(
   const LilvPluginClass* LILV_NONNULL plugin_class);
 
+/**
+   Return true if a plugin class is `ancestor` or a transitive subclass of it.
+
+   This is a constant-time check using an index of all plugin classes that is
+   built when classes are loaded.
+*/
+LILV_API bool
+lilv_plugin_class_is_a(const LilvPluginClass* LILV_NONNULL plugin_class,
+                       const LilvPluginClass* LILV_NONNULL ancestor);
+
+/**
+   @}
+   @defgroup lilv_feature_set Feature Sets
+
+   A feature set is the set of features supported by a host, which can be used
+   to quickly check which plugins the host can use.  Feature URIs are interned
+   in the world, so feature sets can only be used with the world they were
+   created in.
+
+   @{
+*/
+
+/**
+   Create a new feature set.
+
+   @param world The world to intern features in.
+   @param features A null-terminated array of features to add, like the one
+   passed to lilv_plugin_instantiate(), or NULL.
+*/
+LILV_API LilvFeatureSet* LILV_ALLOCATED
+lilv_feature_set_new(
+  LilvWorld* LILV_NONNULL                               world,
+  const LV2_Feature* LILV_NULLABLE const* LILV_NULLABLE features);
+
+/**
+   Free a feature set.
+*/
+LILV_API void
+lilv_feature_set_free(LilvFeatureSet* LILV_NULLABLE set);
+
+/**
+   Add a feature to a set by URI.
+*/
+LILV_API void
+lilv_feature_set_add(LilvFeatureSet* LILV_NONNULL set,
+                     const char* LILV_NONNULL     uri);
+
+/**
+   Return true if a feature set contains a feature.
+
+   This returns false if the feature node is from a different world.
+*/
+LILV_API bool
+lilv_feature_set_contains(const LilvFeatureSet* LILV_NONNULL set,
+                          const LilvNode* LILV_NONNULL       feature);
+
 /**
    @}
    @defgroup lilv_instance Plugin Instances
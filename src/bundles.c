@@ -0,0 +1,138 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE LilvBundle
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "bundles.h"
+
+#include "node_hash.h"
+#include "string_util.h"
+#include "sys_util.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/allocator.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+#include <zix/path.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+ZIX_PURE_FUNC static const SordNode*
+bundle_uri(const LilvBundle* const bundle)
+{
+  return bundle->uri;
+}
+
+static void
+bundle_free(SordWorld* const world, LilvBundle* const bundle)
+{
+  if (bundle) {
+    sord_node_free(world, bundle->uri);
+    free(bundle);
+  }
+}
+
+BundleHash*
+lilv_bundle_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, bundle_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_bundle_hash_free(BundleHash* const hash, SordWorld* const world)
+{
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      bundle_free(world, zix_hash_get(hash, i));
+    }
+  }
+
+  zix_hash_free(hash);
+}
+
+LilvBundle*
+lilv_bundle_hash_find(const BundleHash* const hash, const SordNode* const uri)
+{
+  return zix_hash_find_record(hash, uri);
+}
+
+LilvBundle*
+lilv_bundle_hash_insert(BundleHash* const hash, const SordNode* const uri)
+{
+  const ZixHashInsertPlan plan   = zix_hash_plan_insert(hash, uri);
+  LilvBundle*             bundle = zix_hash_record_at(hash, plan);
+  if (!bundle && (bundle = (LilvBundle*)calloc(1, sizeof(LilvBundle)))) {
+    bundle->uri = sord_node_copy(uri);
+    if (zix_hash_insert_at(hash, plan, bundle)) {
+      free(bundle);
+      return NULL;
+    }
+  }
+
+  return bundle;
+}
+
+void
+lilv_bundle_hash_remove(BundleHash* const     hash,
+                        SordWorld* const      world,
+                        const SordNode* const uri)
+{
+  LilvBundle* removed = NULL;
+  if (!zix_hash_remove(hash, uri, &removed)) {
+    bundle_free(world, removed);
+  }
+}
+
+BundleHashIter
+lilv_bundle_hash_begin(const BundleHash* const hash)
+{
+  return zix_hash_begin(hash);
+}
+
+BundleHashIter
+lilv_bundle_hash_end(const BundleHash* const hash)
+{
+  return zix_hash_end(hash);
+}
+
+LilvBundle*
+lilv_bundle_hash_get(const BundleHash* const hash, const BundleHashIter i)
+{
+  return zix_hash_get(hash, i);
+}
+
+BundleHashIter
+lilv_bundle_hash_next(const BundleHash* const hash, const BundleHashIter i)
+{
+  return zix_hash_next(hash, i);
+}
+
+int
+lilv_bundle_stamp(const SordNode* const uri,
+                  LilvFileStamp* const  dir_stamp,
+                  LilvFileStamp* const  manifest_stamp)
+{
+  char* const dir_path =
+    lilv_file_uri_parse((const char*)sord_node_get_string(uri), NULL);
+  if (!dir_path) {
+    return 1;
+  }
+
+  char* const manifest_path = zix_path_join(NULL, dir_path, "manifest.ttl");
+
+  const int st = lilv_file_stamp(dir_path, dir_stamp);
+  if (!st && lilv_file_stamp(manifest_path, manifest_stamp)) {
+    const LilvFileStamp null_stamp = {0, 0U};
+    *manifest_stamp                = null_stamp;
+  }
+
+  zix_free(NULL, manifest_path);
+  lilv_free(dir_path);
+  return st;
+}
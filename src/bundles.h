@@ -0,0 +1,89 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_BUNDLES_H
+#define LILV_BUNDLES_H
+
+#include "sys_util.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/// A record of a bundle that was discovered in the LV2 path
+typedef struct {
+  SordNode* ZIX_NONNULL uri;            ///< Bundle URI
+  LilvFileStamp         dir_stamp;      ///< Stamp of bundle directory
+  LilvFileStamp         manifest_stamp; ///< Stamp of manifest.ttl
+  bool                  seen;           ///< Seen in the current scan
+} LilvBundle;
+
+typedef struct ZixHashImpl BundleHash;
+typedef size_t             BundleHashIter;
+
+#define BUNDLE_HASH_FOREACH(bh_iter, bh_hash)                           \
+  /* NOLINTNEXTLINE(bugprone-macro-parentheses) */                      \
+  for (BundleHashIter bh_iter = lilv_bundle_hash_begin(bh_hash);        \
+       (bh_iter) != lilv_bundle_hash_end(bh_hash);                      \
+       (bh_iter) = lilv_bundle_hash_next(bh_hash, bh_iter))
+
+/// Return a new empty hash of bundle records keyed by interned URI
+BundleHash* ZIX_ALLOCATED
+lilv_bundle_hash_new(void);
+
+/// Free a bundle hash and all the records in it
+void
+lilv_bundle_hash_free(BundleHash* ZIX_NULLABLE hash,
+                      SordWorld* ZIX_NONNULL   world);
+
+/// Return the record for a bundle, or null
+LilvBundle* ZIX_NULLABLE
+lilv_bundle_hash_find(const BundleHash* ZIX_NONNULL hash,
+                      const SordNode* ZIX_NONNULL   uri);
+
+/// Return the record for a bundle, adding a new one if necessary
+LilvBundle* ZIX_NULLABLE
+lilv_bundle_hash_insert(BundleHash* ZIX_NONNULL     hash,
+                        const SordNode* ZIX_NONNULL uri);
+
+/// Remove and free the record for a bundle
+void
+lilv_bundle_hash_remove(BundleHash* ZIX_NONNULL     hash,
+                        SordWorld* ZIX_NONNULL      world,
+                        const SordNode* ZIX_NONNULL uri);
+
+/// Return an iterator to the first record in a hash, or the end if it is empty
+ZIX_PURE_FUNC BundleHashIter
+lilv_bundle_hash_begin(const BundleHash* ZIX_NONNULL hash);
+
+/// Return an iterator one past the last possible record in the hash
+ZIX_PURE_FUNC BundleHashIter
+lilv_bundle_hash_end(const BundleHash* ZIX_NONNULL hash);
+
+/// Return the record at the given position
+ZIX_PURE_FUNC LilvBundle* ZIX_UNSPECIFIED
+lilv_bundle_hash_get(const BundleHash* ZIX_NONNULL hash, BundleHashIter i);
+
+/// Return an iterator that has been advanced to the next record
+ZIX_PURE_FUNC BundleHashIter
+lilv_bundle_hash_next(const BundleHash* ZIX_NONNULL hash, BundleHashIter i);
+
+/**
+   Get the current stamps of a bundle.
+
+   If the bundle has no manifest, then the manifest stamp is set to zero.
+
+   These stamps only cover the bundle itself, other loaded data files are
+   checked with lilv_file_index_bundle_changed().
+
+   @return Zero on success, or non-zero if the bundle directory couldn't be
+   accessed.
+*/
+int
+lilv_bundle_stamp(const SordNode* ZIX_NONNULL uri,
+                  LilvFileStamp* ZIX_NONNULL  dir_stamp,
+                  LilvFileStamp* ZIX_NONNULL  manifest_stamp);
+
+#endif // LILV_BUNDLES_H
@@ -0,0 +1,545 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+typedef struct CacheEntryImpl CacheEntry;
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE CacheEntry
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "cache.h"
+
+#include "log.h"
+#include "node_hash.h"
+#include "snapshot.h"
+#include "string_util.h"
+#include "sys_util.h"
+
+#include <lilv/lilv.h>
+#include <serd/serd.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+#include <zix/thread.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+  A cache file starts with a header:
+
+  - char[8]: Magic string "LILVDSC" with null terminator
+  - uint32_t: Format version
+  - uint32_t: Byte order mark (0x01020304 in native byte order)
+  - uint32_t: Number of entries
+
+  Then each entry is:
+
+  - uint32_t: URI length
+  - URI, without null terminator
+  - int64_t: File modification time in nanoseconds
+  - uint64_t: File size
+  - uint32_t: Read status
+  - uint32_t: Number of nodes
+  - uint64_t: Size of node records
+  - uint32_t: Number of statements
+  - Node records (see snapshot.c)
+  - Statements, as 3 uint32_t node indices each
+
+  Everything is in native byte order, since the cache is only meaningful for
+  the local system and a mismatched byte order mark simply invalidates it.
+*/
+
+static const char     cache_magic[8]   = {'L', 'I', 'L', 'V', 'D', 'S', 'C', 0};
+static const uint32_t cache_version    = 2U;
+static const uint32_t cache_order_mark = 0x01020304U;
+
+struct CacheEntryImpl {
+  SordNode*     uri;      ///< File URI
+  LilvFileStamp stamp;    ///< File stamp when snapshot was made
+  Snapshot*     snapshot; ///< Statements in file
+  bool          used;     ///< True if used since reading the cache
+};
+
+struct CacheImpl {
+  SordWorld* world;
+  ZixHash*   entries;
+};
+
+ZIX_PURE_FUNC static const SordNode*
+entry_uri(const CacheEntry* const entry)
+{
+  return entry->uri;
+}
+
+static void
+entry_free(SordWorld* const world, CacheEntry* const entry)
+{
+  if (entry) {
+    snapshot_free(entry->snapshot);
+    sord_node_free(world, entry->uri);
+    free(entry);
+  }
+}
+
+static void
+free_entries(Cache* const cache)
+{
+  for (ZixHashIter i = zix_hash_begin(cache->entries);
+       i != zix_hash_end(cache->entries);
+       i = zix_hash_next(cache->entries, i)) {
+    entry_free(cache->world, zix_hash_get(cache->entries, i));
+  }
+
+  zix_hash_free(cache->entries);
+  cache->entries = NULL;
+}
+
+static void
+put_entry(Cache* const               cache,
+          const SordNode* const      uri,
+          const LilvFileStamp* const stamp,
+          Snapshot* const            snapshot,
+          const bool                 used)
+{
+  const ZixHashInsertPlan plan  = zix_hash_plan_insert(cache->entries, uri);
+  CacheEntry*             entry = zix_hash_record_at(cache->entries, plan);
+  if (entry) {
+    // Replace stale entry
+    snapshot_free(entry->snapshot);
+  } else if ((entry = (CacheEntry*)calloc(1, sizeof(CacheEntry)))) {
+    entry->uri = sord_node_copy(uri);
+    if (zix_hash_insert_at(cache->entries, plan, entry)) {
+      entry_free(cache->world, entry);
+      entry = NULL;
+    }
+  }
+
+  if (!entry) {
+    snapshot_free(snapshot);
+    return;
+  }
+
+  entry->stamp    = *stamp;
+  entry->snapshot = snapshot;
+  entry->used     = used;
+}
+
+Cache*
+lilv_cache_new(SordWorld* const world)
+{
+  Cache* const cache = (Cache*)calloc(1, sizeof(Cache));
+  if (cache) {
+    cache->world = world;
+    cache->entries = zix_hash_new(
+      NULL, entry_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+  }
+
+  return cache;
+}
+
+void
+lilv_cache_free(Cache* const cache)
+{
+  if (cache) {
+    free_entries(cache);
+    free(cache);
+  }
+}
+
+/// A bounded cursor for parsing a cache file in memory
+typedef struct {
+  const uint8_t* data;
+  size_t         size;
+  size_t         offset;
+  bool           error;
+} Cursor;
+
+static const uint8_t*
+read_bytes(Cursor* const cursor, const size_t size)
+{
+  if (cursor->error || cursor->size - cursor->offset < size) {
+    cursor->error = true;
+    return NULL;
+  }
+
+  const uint8_t* const ptr = cursor->data + cursor->offset;
+  cursor->offset += size;
+  return ptr;
+}
+
+static uint32_t
+read_u32(Cursor* const cursor)
+{
+  uint32_t             value = 0U;
+  const uint8_t* const ptr   = read_bytes(cursor, sizeof(value));
+  if (ptr) {
+    memcpy(&value, ptr, sizeof(value));
+  }
+
+  return value;
+}
+
+static uint64_t
+read_u64(Cursor* const cursor)
+{
+  uint64_t             value = 0U;
+  const uint8_t* const ptr   = read_bytes(cursor, sizeof(value));
+  if (ptr) {
+    memcpy(&value, ptr, sizeof(value));
+  }
+
+  return value;
+}
+
+static void*
+read_copy(Cursor* const cursor, const size_t size)
+{
+  const uint8_t* const ptr  = read_bytes(cursor, size);
+  void* const          copy = ptr ? malloc(size ? size : 1U) : NULL;
+  if (copy) {
+    memcpy(copy, ptr, size);
+  } else {
+    cursor->error = true;
+  }
+
+  return copy;
+}
+
+static int
+read_entry(Cache* const cache, Cursor* const cursor)
+{
+  const uint32_t       uri_len = read_u32(cursor);
+  const uint8_t* const uri     = read_bytes(cursor, uri_len);
+  const int64_t        mtime   = (int64_t)read_u64(cursor);
+  const uint64_t       size    = read_u64(cursor);
+  const uint32_t       status  = read_u32(cursor);
+  const uint32_t       n_nodes = read_u32(cursor);
+  const uint64_t       n_bytes = read_u64(cursor);
+  const uint32_t       n_stmts = read_u32(cursor);
+  if (cursor->error || n_bytes > cursor->size ||
+      (uint64_t)n_stmts * 3U * sizeof(uint32_t) > cursor->size) {
+    cursor->error = true;
+    return 1;
+  }
+
+  Snapshot* const snapshot = snapshot_new();
+  if (!snapshot) {
+    return 1;
+  }
+
+  snapshot->n_nodes        = n_nodes;
+  snapshot->nodes_size     = (size_t)n_bytes;
+  snapshot->nodes_capacity = (size_t)n_bytes;
+  snapshot->nodes          = (uint8_t*)read_copy(cursor, (size_t)n_bytes);
+  snapshot->n_statements   = n_stmts;
+  snapshot->capacity       = n_stmts;
+  snapshot->statements =
+    (uint32_t*)read_copy(cursor, 3U * sizeof(uint32_t) * (size_t)n_stmts);
+  snapshot->status = (SerdStatus)status;
+
+  if (cursor->error || !snapshot_is_valid(snapshot)) {
+    snapshot_free(snapshot);
+    cursor->error = true;
+    return 1;
+  }
+
+  char* const uri_str = (char*)calloc(1, (size_t)uri_len + 1U);
+  if (!uri_str) {
+    snapshot_free(snapshot);
+    return 1;
+  }
+
+  memcpy(uri_str, uri, uri_len);
+
+  SordNode* const uri_node = sord_new_uri(cache->world, (uint8_t*)uri_str);
+  free(uri_str);
+
+  // Entries read from disk are only written back if they're used again
+  const LilvFileStamp stamp = {mtime, size};
+  put_entry(cache, uri_node, &stamp, snapshot, false);
+  sord_node_free(cache->world, uri_node);
+  return 0;
+}
+
+int
+lilv_cache_read(Cache* const cache, const char* const path)
+{
+  FILE* const file = fopen(path, "rb");
+  if (!file) {
+    return errno;
+  }
+
+  uint8_t* data = NULL;
+  long     size = 0;
+  if (!fseek(file, 0, SEEK_END) && (size = ftell(file)) > 0 &&
+      !fseek(file, 0, SEEK_SET) && (data = (uint8_t*)malloc((size_t)size)) &&
+      fread(data, 1, (size_t)size, file) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+
+  fclose(file);
+  if (!data) {
+    return 1;
+  }
+
+  Cursor               cursor    = {data, (size_t)size, 0U, false};
+  const uint8_t* const magic     = read_bytes(&cursor, sizeof(cache_magic));
+  const uint32_t       version   = read_u32(&cursor);
+  const uint32_t       order     = read_u32(&cursor);
+  const uint32_t       n_entries = read_u32(&cursor);
+
+  int st = 0;
+  if (cursor.error || memcmp(magic, cache_magic, sizeof(cache_magic)) ||
+      version != cache_version || order != cache_order_mark) {
+    st = 1;
+  }
+
+  for (uint32_t i = 0U; !st && i < n_entries; ++i) {
+    st = read_entry(cache, &cursor);
+  }
+
+  if (st) {
+    LILV_WARNF("Ignoring invalid cache file %s\n", path);
+    free_entries(cache);
+    cache->entries = zix_hash_new(
+      NULL, entry_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+  }
+
+  free(data);
+  return st;
+}
+
+static bool
+write_u32(FILE* const file, const uint32_t value)
+{
+  return fwrite(&value, sizeof(value), 1, file) == 1;
+}
+
+static bool
+write_u64(FILE* const file, const uint64_t value)
+{
+  return fwrite(&value, sizeof(value), 1, file) == 1;
+}
+
+static bool
+write_bytes(FILE* const file, const void* const data, const size_t size)
+{
+  return !size || fwrite(data, 1, size, file) == size;
+}
+
+static bool
+write_entry(FILE* const file, const CacheEntry* const entry)
+{
+  size_t               uri_len = 0U;
+  const uint8_t* const uri = sord_node_get_string_counted(entry->uri, &uri_len);
+
+  const Snapshot* const snapshot = entry->snapshot;
+
+  return write_u32(file, (uint32_t)uri_len) &&
+         write_bytes(file, uri, uri_len) &&
+         write_u64(file, (uint64_t)entry->stamp.mtime) &&
+         write_u64(file, entry->stamp.size) &&
+         write_u32(file, (uint32_t)snapshot->status) &&
+         write_u32(file, snapshot->n_nodes) &&
+         write_u64(file, (uint64_t)snapshot->nodes_size) &&
+         write_u32(file, snapshot->n_statements) &&
+         write_bytes(file, snapshot->nodes, snapshot->nodes_size) &&
+         write_bytes(file,
+                     snapshot->statements,
+                     3U * sizeof(uint32_t) * (size_t)snapshot->n_statements);
+}
+
+int
+lilv_cache_write(const Cache* const cache, const char* const path)
+{
+  char* const tmp_path = lilv_strjoin(path, ".tmp", NULL);
+  FILE* const file     = fopen(tmp_path, "wb");
+  if (!file) {
+    LILV_ERRORF("Failed to open %s (%s)\n", tmp_path, strerror(errno));
+    free(tmp_path);
+    return 1;
+  }
+
+  uint32_t n_entries = 0U;
+  for (ZixHashIter i = zix_hash_begin(cache->entries);
+       i != zix_hash_end(cache->entries);
+       i = zix_hash_next(cache->entries, i)) {
+    n_entries += zix_hash_get(cache->entries, i)->used ? 1U : 0U;
+  }
+
+  bool ok = write_bytes(file, cache_magic, sizeof(cache_magic)) &&
+            write_u32(file, cache_version) &&
+            write_u32(file, cache_order_mark) && write_u32(file, n_entries);
+
+  for (ZixHashIter i = zix_hash_begin(cache->entries);
+       ok && i != zix_hash_end(cache->entries);
+       i = zix_hash_next(cache->entries, i)) {
+    const CacheEntry* const entry = zix_hash_get(cache->entries, i);
+    if (entry->used) {
+      ok = write_entry(file, entry);
+    }
+  }
+
+  ok = !fclose(file) && ok;
+
+#ifdef _WIN32
+  if (ok) {
+    remove(path);
+  }
+#endif
+
+  if (!ok || rename(tmp_path, path)) {
+    LILV_ERRORF("Failed to write cache file %s\n", path);
+    remove(tmp_path);
+    free(tmp_path);
+    return 1;
+  }
+
+  free(tmp_path);
+  return 0;
+}
+
+const Snapshot*
+lilv_cache_find(Cache* const               cache,
+                const SordNode* const      uri,
+                const LilvFileStamp* const stamp)
+{
+  CacheEntry* const entry = zix_hash_find_record(cache->entries, uri);
+  if (!entry || !lilv_file_stamp_equals(&entry->stamp, stamp)) {
+    return NULL;
+  }
+
+  entry->used = true;
+  return entry->snapshot;
+}
+
+void
+lilv_cache_insert(Cache* const               cache,
+                  const SordNode* const      uri,
+                  const LilvFileStamp* const stamp,
+                  Snapshot* const            snapshot)
+{
+  put_entry(cache, uri, stamp, snapshot, true);
+}
+
+/// A file that needs to be read into a snapshot
+typedef struct {
+  const SordNode* uri;
+  const SordNode* base;
+  LilvFileStamp   stamp;
+  Snapshot*       snapshot;
+} PrefetchJob;
+
+/// A strided slice of the jobs for one thread
+typedef struct {
+  PrefetchJob* jobs;
+  size_t       n_jobs;
+  size_t       first;
+  size_t       stride;
+  bool         map;
+} PrefetchWorker;
+
+static ZixThreadResult ZIX_THREAD_FUNC
+prefetch_thread(void* const arg)
+{
+  const PrefetchWorker* const worker = (const PrefetchWorker*)arg;
+
+  for (size_t i = worker->first; i < worker->n_jobs; i += worker->stride) {
+    PrefetchJob* const job = &worker->jobs[i];
+    if ((job->snapshot = snapshot_new())) {
+      snapshot_read_file(job->snapshot,
+                         sord_node_to_serd_node(job->base),
+                         sord_node_get_string(job->uri),
+                         worker->map);
+    }
+  }
+
+  return ZIX_THREAD_RESULT;
+}
+
+void
+lilv_cache_prefetch(Cache* const              cache,
+                    const size_t              n_requests,
+                    const CacheRequest* const requests,
+                    const unsigned            n_threads,
+                    const bool                map)
+{
+  PrefetchJob* const jobs =
+    (PrefetchJob*)calloc(n_requests ? n_requests : 1U, sizeof(PrefetchJob));
+  if (!jobs) {
+    return;
+  }
+
+  // Stat every file and make a job for each one that isn't already cached
+  size_t n_jobs = 0U;
+  for (size_t i = 0U; i < n_requests; ++i) {
+    const SordNode* const uri     = requests[i].uri;
+    const char* const     uri_str = (const char*)sord_node_get_string(uri);
+    if (strncmp(uri_str, "file:", 5)) {
+      continue;
+    }
+
+    char* const   path  = lilv_file_uri_parse(uri_str, NULL);
+    LilvFileStamp stamp = {0, 0U};
+    if (path && !lilv_file_stamp(path, &stamp) &&
+        !lilv_cache_find(cache, uri, &stamp)) {
+      const PrefetchJob job = {uri, requests[i].base, stamp, NULL};
+      jobs[n_jobs++]        = job;
+    }
+
+    lilv_free(path);
+  }
+
+  // Read files into snapshots, using the calling thread as the first worker
+  const size_t n_workers =
+    (n_threads < 1U) ? 1U : (n_threads < n_jobs) ? n_threads : n_jobs;
+
+  PrefetchWorker* const workers =
+    (PrefetchWorker*)calloc(n_workers ? n_workers : 1U, sizeof(PrefetchWorker));
+  ZixThread* const threads =
+    (ZixThread*)calloc(n_workers ? n_workers : 1U, sizeof(ZixThread));
+  bool* const launched =
+    (bool*)calloc(n_workers ? n_workers : 1U, sizeof(bool));
+
+  if (n_jobs && workers && threads && launched) {
+    for (size_t w = 0U; w < n_workers; ++w) {
+      const PrefetchWorker worker = {jobs, n_jobs, w, n_workers, map};
+      workers[w]                  = worker;
+    }
+
+    for (size_t w = 1U; w < n_workers; ++w) {
+      launched[w] = !zix_thread_create(
+        &threads[w], 1U << 20U, prefetch_thread, &workers[w]);
+    }
+
+    prefetch_thread(&workers[0]);
+
+    // Join threads, and do the work of any that failed to launch here
+    for (size_t w = 1U; w < n_workers; ++w) {
+      if (launched[w]) {
+        zix_thread_join(threads[w]);
+      } else {
+        prefetch_thread(&workers[w]);
+      }
+    }
+  }
+
+  // Insert snapshots into the cache in the original order
+  for (size_t i = 0U; i < n_jobs; ++i) {
+    if (jobs[i].snapshot) {
+      lilv_cache_insert(cache, jobs[i].uri, &jobs[i].stamp, jobs[i].snapshot);
+    }
+  }
+
+  free(launched);
+  free(threads);
+  free(workers);
+  free(jobs);
+}
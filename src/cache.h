@@ -0,0 +1,93 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_CACHE_H
+#define LILV_CACHE_H
+
+#include "snapshot.h"
+#include "sys_util.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+   A persistent cache of parsed discovery data.
+
+   This maps file URIs to a snapshot of the statements in the file, along with
+   the stamp (modification time and size) of the file when it was read.  An
+   entry is only used if the file's current stamp matches exactly, so changed
+   files are always parsed again.
+*/
+typedef struct CacheImpl Cache;
+
+/// Return a new empty cache
+Cache* ZIX_ALLOCATED
+lilv_cache_new(SordWorld* ZIX_NONNULL world);
+
+/// Free a cache and all the snapshots in it
+void
+lilv_cache_free(Cache* ZIX_NULLABLE cache);
+
+/**
+   Read entries from a cache file.
+
+   If the file doesn't exist, or isn't a valid cache file from a compatible
+   build, then nothing is read and the cache is left empty.
+
+   @return Zero if the cache file was read successfully.
+*/
+int
+lilv_cache_read(Cache* ZIX_NONNULL cache, const char* ZIX_NONNULL path);
+
+/**
+   Write the entries that have been used since reading to a cache file.
+
+   Entries that weren't used are discarded, so files that no longer exist are
+   eventually dropped from the cache.  The file is written to a temporary path
+   first, then renamed, so readers never see a partially written cache.
+
+   @return Zero on success.
+*/
+int
+lilv_cache_write(const Cache* ZIX_NONNULL cache, const char* ZIX_NONNULL path);
+
+/// Find a fresh snapshot for a file and mark it as used, or return null
+const Snapshot* ZIX_NULLABLE
+lilv_cache_find(Cache* ZIX_NONNULL               cache,
+                const SordNode* ZIX_NONNULL      uri,
+                const LilvFileStamp* ZIX_NONNULL stamp);
+
+/// A file to read into the cache
+typedef struct {
+  const SordNode* ZIX_NONNULL uri;  ///< File URI
+  const SordNode* ZIX_NONNULL base; ///< Base URI for reading
+} CacheRequest;
+
+/**
+   Read any missing or stale files into the cache in parallel.
+
+   Files are read into snapshots by up to `n_threads` threads (including the
+   calling thread), then inserted into the cache in order.  This only reads
+   syntax, and never touches a world, so it's safe to use any number of
+   threads.  Loading the requested files afterwards will replay the snapshots.
+   If `map` is true, then files are mapped into memory to read them if
+   possible, as with lilv_mapped_file_read().
+*/
+void
+lilv_cache_prefetch(Cache* ZIX_NONNULL              cache,
+                    size_t                          n_requests,
+                    const CacheRequest* ZIX_NONNULL requests,
+                    unsigned                        n_threads,
+                    bool                            map);
+
+/// Insert a snapshot for a file (taking ownership) and mark it as used
+void
+lilv_cache_insert(Cache* ZIX_NONNULL               cache,
+                  const SordNode* ZIX_NONNULL      uri,
+                  const LilvFileStamp* ZIX_NONNULL stamp,
+                  Snapshot* ZIX_NONNULL            snapshot);
+
+#endif // LILV_CACHE_H
@@ -2,16 +2,38 @@
 // SPDX-License-Identifier: ISC
 
 #include "lilv_internal.h"
+#include "value_hash.h"
 
 #include <lilv/lilv.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
+#include <zix/status.h>
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Minimum size of a node collection to build a hash for membership tests
+#define LILV_COLLECTION_HASH_MIN_SIZE 16U
 
 typedef void (*LilvFreeFunc)(void* ptr);
 
+/**
+   A collection of pointers stored contiguously.
+
+   Collections with a comparator are kept sorted so elements can be found with
+   a binary search, and others are kept in insertion order.
+*/
+struct LilvCollectionImpl {
+  LilvCompareFunc cmp;       ///< Element comparator, or null
+  LilvFreeFunc    free_func; ///< Element destructor, or null
+  void**          elements;  ///< Array of elements
+  unsigned        size;      ///< Number of elements
+  unsigned        capacity;  ///< Allocated size of elements
+  bool            hashed;    ///< True if values are hashed when large
+  ValueHash*      values;    ///< Node membership hash, or null
+};
+
 int
 lilv_ptr_cmp(const void* a, const void* b, const void* user_data)
 {
@@ -33,38 +55,60 @@ lilv_resource_node_cmp(const void* a, const void* b, const void* user_data)
 
 /* Generic collection functions */
 
-static void
-destroy(void* const ptr, const void* const user_data)
+static LilvCollection*
+lilv_collection_new(LilvCompareFunc cmp, LilvFreeFunc free_func)
 {
-  if (user_data) {
-    ((LilvFreeFunc)user_data)(ptr);
+  LilvCollection* const collection =
+    (LilvCollection*)calloc(1, sizeof(LilvCollection));
+
+  if (collection) {
+    collection->cmp       = cmp;
+    collection->free_func = free_func;
   }
-}
 
-static inline LilvCollection*
-lilv_collection_new(ZixTreeCompareFunc cmp, LilvFreeFunc free_func)
-{
-  return zix_tree_new(NULL, false, cmp, NULL, destroy, (const void*)free_func);
+  return collection;
 }
 
 static void
 lilv_collection_free(LilvCollection* collection)
 {
   if (collection) {
-    zix_tree_free((ZixTree*)collection);
+    if (collection->free_func) {
+      for (unsigned i = 0U; i < collection->size; ++i) {
+        collection->free_func(collection->elements[i]);
+      }
+    }
+
+    lilv_value_hash_free(collection->values);
+    free(collection->elements);
+    free(collection);
   }
 }
 
 static unsigned
 lilv_collection_size(const LilvCollection* collection)
 {
-  return (collection ? zix_tree_size((const ZixTree*)collection) : 0);
+  return collection ? collection->size : 0U;
 }
 
 static LilvIter*
 lilv_collection_begin(const LilvCollection* collection)
 {
-  return collection ? (LilvIter*)zix_tree_begin((ZixTree*)collection) : NULL;
+  return (collection && collection->size) ? (LilvIter*)collection->elements
+                                          : NULL;
+}
+
+static LilvIter*
+lilv_collection_next(const LilvCollection* collection, LilvIter* i)
+{
+  if (!collection || !i) {
+    return NULL;
+  }
+
+  void** const next = (void**)i + 1U;
+
+  return next < collection->elements + collection->size ? (LilvIter*)next
+                                                        : NULL;
 }
 
 void*
@@ -72,7 +116,180 @@ lilv_collection_get(const LilvCollection* collection, const LilvIter* i)
 {
   (void)collection;
 
-  return zix_tree_get((const ZixTreeIter*)i);
+  return i ? *(void* const*)i : NULL;
+}
+
+void*
+lilv_collection_get_at(const LilvCollection* collection, unsigned index)
+{
+  return (collection && index < collection->size)
+           ? collection->elements[index]
+           : NULL;
+}
+
+/// Return the index of the first element that isn't less than `key`
+static unsigned
+lilv_collection_lower_bound(const LilvCollection* collection, const void* key)
+{
+  unsigned lo = 0U;
+  unsigned hi = collection->size;
+
+  while (lo < hi) {
+    const unsigned mid = lo + ((hi - lo) / 2U);
+
+    if (collection->cmp(collection->elements[mid], key, NULL) < 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+/// Add every element to a new membership hash if the collection is large
+static void
+lilv_collection_hash_values(LilvCollection* collection)
+{
+  if (!collection->hashed || collection->values ||
+      collection->size < LILV_COLLECTION_HASH_MIN_SIZE) {
+    return;
+  }
+
+  if ((collection->values = lilv_value_hash_new())) {
+    for (unsigned i = 0U; i < collection->size; ++i) {
+      const ZixStatus st = lilv_value_hash_insert(
+        collection->values, (const LilvNode*)collection->elements[i]);
+
+      if (st && st != ZIX_STATUS_EXISTS) {
+        // Fall back to searching linearly
+        lilv_value_hash_free(collection->values);
+        collection->values = NULL;
+        break;
+      }
+    }
+  }
+}
+
+static ZixStatus
+lilv_collection_reserve(LilvCollection* collection, unsigned capacity)
+{
+  if (capacity > collection->capacity) {
+    unsigned new_capacity = collection->capacity ? collection->capacity : 4U;
+    while (new_capacity < capacity) {
+      new_capacity *= 2U;
+    }
+
+    void** const new_elements = (void**)realloc(
+      collection->elements, (size_t)new_capacity * sizeof(void*));
+    if (!new_elements) {
+      return ZIX_STATUS_NO_MEM;
+    }
+
+    collection->elements = new_elements;
+    collection->capacity = new_capacity;
+  }
+
+  return ZIX_STATUS_SUCCESS;
+}
+
+ZixStatus
+lilv_collection_insert(LilvCollection* collection, void* element)
+{
+  unsigned index = collection->size;
+  if (collection->cmp) {
+    index = lilv_collection_lower_bound(collection, element);
+    if (index < collection->size &&
+        !collection->cmp(collection->elements[index], element, NULL)) {
+      return ZIX_STATUS_EXISTS;
+    }
+  }
+
+  const ZixStatus st =
+    lilv_collection_reserve(collection, collection->size + 1U);
+  if (st) {
+    return st;
+  }
+
+  memmove(collection->elements + index + 1U,
+          collection->elements + index,
+          (size_t)(collection->size - index) * sizeof(void*));
+
+  collection->elements[index] = element;
+  ++collection->size;
+
+  if (collection->values) {
+    const ZixStatus hst =
+      lilv_value_hash_insert(collection->values, (const LilvNode*)element);
+
+    if (hst && hst != ZIX_STATUS_EXISTS) {
+      // Fall back to searching linearly
+      lilv_value_hash_free(collection->values);
+      collection->values = NULL;
+    }
+  } else {
+    lilv_collection_hash_values(collection);
+  }
+
+  return ZIX_STATUS_SUCCESS;
+}
+
+void*
+lilv_collection_remove_at(LilvCollection* collection, unsigned index)
+{
+  if (index >= collection->size) {
+    return NULL;
+  }
+
+  void* const element = collection->elements[index];
+
+  --collection->size;
+  memmove(collection->elements + index,
+          collection->elements + index + 1U,
+          (size_t)(collection->size - index) * sizeof(void*));
+
+  // Rebuild the membership hash, since values can't be removed from it
+  if (collection->values) {
+    lilv_value_hash_free(collection->values);
+    collection->values = NULL;
+    lilv_collection_hash_values(collection);
+  }
+
+  return element;
+}
+
+/// Return the index of the element with the given URI, or the size
+static unsigned
+lilv_collection_find_by_uri(const LilvCollection* collection,
+                            const LilvNode*       uri)
+{
+  if (collection && lilv_node_is_uri(uri)) {
+    const struct LilvHeader key = {NULL, (LilvNode*)uri};
+    const unsigned          index =
+      lilv_collection_lower_bound(collection, &key);
+
+    if (index < collection->size &&
+        !collection->cmp(collection->elements[index], &key, NULL)) {
+      return index;
+    }
+  }
+
+  return lilv_collection_size(collection);
+}
+
+struct LilvHeader*
+lilv_collection_get_by_uri(const LilvCollection* collection,
+                           const LilvNode*       uri)
+{
+  return (struct LilvHeader*)lilv_collection_get_at(
+    collection, lilv_collection_find_by_uri(collection, uri));
+}
+
+struct LilvHeader*
+lilv_collection_remove_by_uri(LilvCollection* collection, const LilvNode* uri)
+{
+  return (struct LilvHeader*)lilv_collection_remove_at(
+    collection, lilv_collection_find_by_uri(collection, uri));
 }
 
 /* Constructors */
@@ -80,13 +297,27 @@ lilv_collection_get(const LilvCollection* collection, const LilvIter* i)
 LilvScalePoints*
 lilv_scale_points_new(void)
 {
-  return lilv_collection_new(lilv_ptr_cmp, (LilvFreeFunc)lilv_scale_point_free);
+  return lilv_collection_new(NULL, (LilvFreeFunc)lilv_scale_point_free);
+}
+
+LilvScalePoints*
+lilv_scale_points_new_sorted(void)
+{
+  return lilv_collection_new(lilv_scale_point_cmp,
+                             (LilvFreeFunc)lilv_scale_point_free);
 }
 
 LilvNodes*
 lilv_nodes_new(void)
 {
-  return lilv_collection_new(lilv_ptr_cmp, (LilvFreeFunc)lilv_node_free);
+  LilvCollection* const collection =
+    lilv_collection_new(NULL, (LilvFreeFunc)lilv_node_free);
+
+  if (collection) {
+    collection->hashed = true;
+  }
+
+  return collection;
 }
 
 LilvUIs*
@@ -103,20 +334,25 @@ lilv_plugin_classes_new(void)
                              (LilvFreeFunc)lilv_plugin_class_free);
 }
 
+LilvPluginClasses*
+lilv_plugin_classes_new_view(void)
+{
+  return lilv_collection_new(lilv_header_compare_by_uri, NULL);
+}
+
 /* URI based accessors (for collections of things with URIs) */
 
 const LilvPluginClass*
 lilv_plugin_classes_get_by_uri(const LilvPluginClasses* classes,
                                const LilvNode*          uri)
 {
-  return (LilvPluginClass*)lilv_collection_get_by_uri((const ZixTree*)classes,
-                                                      uri);
+  return (LilvPluginClass*)lilv_collection_get_by_uri(classes, uri);
 }
 
 const LilvUI*
 lilv_uis_get_by_uri(const LilvUIs* uis, const LilvNode* uri)
 {
-  return (LilvUI*)lilv_collection_get_by_uri((const ZixTree*)uis, uri);
+  return (LilvUI*)lilv_collection_get_by_uri(uis, uri);
 }
 
 /* Plugins */
@@ -130,7 +366,12 @@ lilv_plugins_new(void)
 const LilvPlugin*
 lilv_plugins_get_by_uri(const LilvPlugins* plugins, const LilvNode* uri)
 {
-  return (LilvPlugin*)lilv_collection_get_by_uri((const ZixTree*)plugins, uri);
+  // Use the index if this is the list of all plugins in the world
+  if (lilv_node_is_uri(uri) && plugins == uri->world->plugins) {
+    return lilv_plugin_hash_find(uri->world->plugin_index, uri->node);
+  }
+
+  return (LilvPlugin*)lilv_collection_get_by_uri(plugins, uri);
 }
 
 /* Nodes */
@@ -138,8 +379,14 @@ lilv_plugins_get_by_uri(const LilvPlugins* plugins, const LilvNode* uri)
 bool
 lilv_nodes_contains(const LilvNodes* nodes, const LilvNode* value)
 {
-  LILV_FOREACH (nodes, i, nodes) {
-    if (lilv_node_equals(lilv_nodes_get(nodes, i), value)) {
+  const LilvCollection* const collection = nodes;
+
+  if (collection->values) {
+    return lilv_value_hash_contains(collection->values, value);
+  }
+
+  for (unsigned i = 0U; i < collection->size; ++i) {
+    if (lilv_node_equals((const LilvNode*)collection->elements[i], value)) {
       return true;
     }
   }
@@ -147,19 +394,26 @@ lilv_nodes_contains(const LilvNodes* nodes, const LilvNode* value)
   return false;
 }
 
-LilvNodes*
-lilv_nodes_merge(const LilvNodes* a, const LilvNodes* b)
+static void
+lilv_nodes_append_copies(LilvCollection* result, const LilvCollection* nodes)
 {
-  LilvNodes* result = lilv_nodes_new();
-
-  LILV_FOREACH (nodes, i, a) {
-    zix_tree_insert(
-      (ZixTree*)result, lilv_node_duplicate(lilv_nodes_get(a, i)), NULL);
+  for (unsigned i = 0U; i < lilv_collection_size(nodes); ++i) {
+    result->elements[result->size++] =
+      lilv_node_duplicate((const LilvNode*)nodes->elements[i]);
   }
+}
 
-  LILV_FOREACH (nodes, i, b) {
-    zix_tree_insert(
-      (ZixTree*)result, lilv_node_duplicate(lilv_nodes_get(b, i)), NULL);
+LilvNodes*
+lilv_nodes_merge(const LilvNodes* a, const LilvNodes* b)
+{
+  LilvCollection* const result = lilv_nodes_new();
+  const unsigned        size   = lilv_nodes_size(a) + lilv_nodes_size(b);
+
+  // Reserve space for everything then append copies without searching
+  if (!lilv_collection_reserve(result, size)) {
+    lilv_nodes_append_copies(result, a);
+    lilv_nodes_append_copies(result, b);
+    lilv_collection_hash_values(result);
   }
 
   return result;
@@ -184,16 +438,20 @@ lilv_nodes_merge(const LilvNodes* a, const LilvNodes* b)
     return (ET*)lilv_collection_get(collection, i);               \
   }                                                               \
                                                                   \
+  const ET* prefix##_get_at(const CT* collection, unsigned index) \
+  {                                                               \
+    return (ET*)lilv_collection_get_at(collection, index);        \
+  }                                                               \
+                                                                  \
   LilvIter* prefix##_next(const CT* collection, LilvIter* i)      \
   {                                                               \
-    (void)collection;                                             \
-    return zix_tree_iter_next((ZixTreeIter*)i);                   \
+    return lilv_collection_next(collection, i);                   \
   }                                                               \
                                                                   \
   bool prefix##_is_end(const CT* collection, const LilvIter* i)   \
   {                                                               \
     (void)collection;                                             \
-    return zix_tree_iter_is_end((const ZixTreeIter*)i);           \
+    return !i;                                                    \
   }
 
 LILV_COLLECTION_IMPL(lilv_plugin_classes, LilvPluginClasses, LilvPluginClass)
@@ -220,6 +478,12 @@ lilv_uis_free(LilvUIs* collection)
   lilv_collection_free(collection);
 }
 
+void
+lilv_plugins_free(LilvPlugins* collection)
+{
+  lilv_collection_free(collection);
+}
+
 void
 lilv_nodes_free(LilvNodes* collection)
 {
@@ -229,6 +493,5 @@ lilv_nodes_free(LilvNodes* collection)
 LilvNode*
 lilv_nodes_get_first(const LilvNodes* collection)
 {
-  return (LilvNode*)lilv_collection_get(collection,
-                                        lilv_collection_begin(collection));
+  return (LilvNode*)lilv_collection_get_at(collection, 0U);
 }
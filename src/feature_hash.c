@@ -0,0 +1,143 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE FeatureRecord
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "feature_hash.h"
+
+#include "node_hash.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+ZIX_PURE_FUNC static const SordNode*
+feature_uri(const FeatureRecord* const record)
+{
+  return record->uri;
+}
+
+FeatureHash*
+lilv_feature_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, feature_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_feature_hash_free(FeatureHash* const hash, SordWorld* const world)
+{
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      FeatureRecord* const record = zix_hash_get(hash, i);
+      if (world) {
+        sord_node_free(world, record->uri);
+      }
+
+      free(record);
+    }
+  }
+
+  zix_hash_free(hash);
+}
+
+uint32_t
+lilv_feature_hash_size(const FeatureHash* const hash)
+{
+  return (uint32_t)zix_hash_size(hash);
+}
+
+uint32_t
+lilv_feature_hash_find(const FeatureHash* const hash, const SordNode* const uri)
+{
+  const FeatureRecord* const record = zix_hash_find_record(hash, uri);
+
+  return record ? record->id : UINT32_MAX;
+}
+
+uint32_t
+lilv_feature_hash_intern(FeatureHash* const hash, const SordNode* const uri)
+{
+  const ZixHashInsertPlan plan     = zix_hash_plan_insert(hash, uri);
+  const FeatureRecord*    existing = zix_hash_record_at(hash, plan);
+  if (existing) {
+    return existing->id;
+  }
+
+  FeatureRecord* const record = (FeatureRecord*)malloc(sizeof(FeatureRecord));
+  if (!record) {
+    return UINT32_MAX;
+  }
+
+  record->uri = (SordNode*)uri;
+  record->id  = lilv_feature_hash_size(hash);
+  if (zix_hash_insert_at(hash, plan, record)) {
+    free(record);
+    return UINT32_MAX;
+  }
+
+  sord_node_copy(uri); // Reference for record->uri, released in free
+  return record->id;
+}
+
+int
+lilv_feature_bits_add(FeatureBits* const bits, const uint32_t id)
+{
+  const uint32_t w = id / 64U;
+  if (w >= bits->n_words) {
+    uint64_t* const words =
+      (uint64_t*)realloc(bits->words, (w + 1U) * sizeof(uint64_t));
+    if (!words) {
+      return 1;
+    }
+
+    for (uint32_t i = bits->n_words; i <= w; ++i) {
+      words[i] = 0U;
+    }
+
+    bits->words   = words;
+    bits->n_words = w + 1U;
+  }
+
+  bits->words[w] |= 1ULL << (id % 64U);
+  return 0;
+}
+
+bool
+lilv_feature_bits_has(const FeatureBits* const bits, const uint32_t id)
+{
+  const uint32_t w = id / 64U;
+
+  return w < bits->n_words && (bits->words[w] & (1ULL << (id % 64U)));
+}
+
+bool
+lilv_feature_bits_includes(const FeatureBits* const set,
+                           const FeatureBits* const subset)
+{
+  for (uint32_t w = 0U; w < subset->n_words; ++w) {
+    const uint64_t have = w < set->n_words ? set->words[w] : 0U;
+    if (subset->words[w] & ~have) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void
+lilv_feature_bits_clear(FeatureBits* const bits)
+{
+  free(bits->words);
+  bits->words   = NULL;
+  bits->n_words = 0U;
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_FEATURE_HASH_H
+#define LILV_FEATURE_HASH_H
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// A feature URI interned with a dense ID
+typedef struct {
+  SordNode* uri; ///< Feature URI
+  uint32_t  id;  ///< Index of feature bit in feature sets
+} FeatureRecord;
+
+/// A set of feature IDs
+typedef struct {
+  uint64_t* ZIX_NULLABLE words;   ///< Bit for each feature ID
+  uint32_t               n_words; ///< Number of words
+} FeatureBits;
+
+/// A hash of feature records keyed by interned URI
+typedef struct ZixHashImpl FeatureHash;
+
+/// Return a new empty feature hash
+FeatureHash* ZIX_ALLOCATED
+lilv_feature_hash_new(void);
+
+/// Free a feature hash and drop its references to nodes in `world`
+void
+lilv_feature_hash_free(FeatureHash* ZIX_NULLABLE hash,
+                       SordWorld* ZIX_NULLABLE   world);
+
+/// Return the number of features in the hash
+uint32_t
+lilv_feature_hash_size(const FeatureHash* ZIX_NONNULL hash);
+
+/// Return the ID of the given feature, or UINT32_MAX if it isn't interned
+uint32_t
+lilv_feature_hash_find(const FeatureHash* ZIX_NONNULL hash,
+                       const SordNode* ZIX_NONNULL    uri);
+
+/// Return the ID of the given feature, adding it if necessary
+uint32_t
+lilv_feature_hash_intern(FeatureHash* ZIX_NONNULL    hash,
+                         const SordNode* ZIX_NONNULL uri);
+
+/// Add a feature ID to a set, growing it if necessary, return non-zero on error
+int
+lilv_feature_bits_add(FeatureBits* ZIX_NONNULL bits, uint32_t id);
+
+/// Return true if a feature ID is in a set
+bool
+lilv_feature_bits_has(const FeatureBits* ZIX_NONNULL bits, uint32_t id);
+
+/// Return true if every feature in `subset` is also in `set`
+bool
+lilv_feature_bits_includes(const FeatureBits* ZIX_NONNULL set,
+                           const FeatureBits* ZIX_NONNULL subset);
+
+/// Free the words of a set and reset it to empty
+void
+lilv_feature_bits_clear(FeatureBits* ZIX_NONNULL bits);
+
+#endif // LILV_FEATURE_HASH_H
@@ -0,0 +1,65 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "feature_hash.h"
+#include "lilv_internal.h"
+
+#include <lilv/lilv.h>
+#include <lv2/core/lv2.h>
+#include <sord/sord.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+LilvFeatureSet*
+lilv_feature_set_new(LilvWorld* const world, const LV2_Feature* const* features)
+{
+  LilvFeatureSet* const set =
+    (LilvFeatureSet*)calloc(1, sizeof(LilvFeatureSet));
+  if (set) {
+    set->world = world;
+    for (const LV2_Feature* const* f = features; f && *f; ++f) {
+      lilv_feature_set_add(set, (*f)->URI);
+    }
+  }
+
+  return set;
+}
+
+void
+lilv_feature_set_free(LilvFeatureSet* const set)
+{
+  if (set) {
+    lilv_feature_bits_clear(&set->features);
+    free(set);
+  }
+}
+
+void
+lilv_feature_set_add(LilvFeatureSet* const set, const char* const uri)
+{
+  SordWorld* const sord_world = set->world->world;
+  SordNode* const  node       = sord_new_uri(sord_world, (const uint8_t*)uri);
+
+  const uint32_t id = lilv_feature_hash_intern(set->world->features, node);
+  if (id != UINT32_MAX) {
+    lilv_feature_bits_add(&set->features, id);
+  }
+
+  sord_node_free(sord_world, node);
+}
+
+bool
+lilv_feature_set_contains(const LilvFeatureSet* const set,
+                          const LilvNode* const       feature)
+{
+  if (feature->world != set->world) {
+    return false;
+  }
+
+  const uint32_t id =
+    lilv_feature_hash_find(set->world->features, feature->node);
+
+  return id != UINT32_MAX && lilv_feature_bits_has(&set->features, id);
+}
@@ -0,0 +1,296 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+typedef struct BundleFilesImpl BundleFiles;
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE BundleFiles
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "file_index.h"
+
+#include "file_stamps.h"
+#include "node_hash.h"
+#include "string_util.h"
+#include "sys_util.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// The loaded files in a bundle
+struct BundleFilesImpl {
+  SordNode*      bundle; ///< Bundle URI
+  NodeHash*      files;  ///< Loaded files in bundle, or null
+  FileStampHash* stamps; ///< Stamps of the loaded files that have them
+};
+
+struct FileIndexImpl {
+  ZixHash*  bundles; ///< Bundle files keyed by bundle URI
+  NodeHash* orphans; ///< Loaded files not in any added bundle
+};
+
+ZIX_PURE_FUNC static const SordNode*
+record_bundle(const BundleFiles* const record)
+{
+  return record->bundle;
+}
+
+static bool
+node_hash_contains(const NodeHash* const hash, const SordNode* const node)
+{
+  return lilv_node_hash_find(hash, node) != lilv_node_hash_end(hash);
+}
+
+static bool
+file_is_in_bundle(const SordNode* const file, const SordNode* const bundle)
+{
+  size_t               file_len = 0U;
+  const uint8_t* const file_str = sord_node_get_string_counted(file, &file_len);
+
+  size_t               bundle_len = 0U;
+  const uint8_t* const bundle_str =
+    sord_node_get_string_counted(bundle, &bundle_len);
+
+  return file == bundle ||
+         (file_len > bundle_len &&
+          !strncmp((const char*)file_str, (const char*)bundle_str, bundle_len));
+}
+
+// Get the current stamp of a file by URI, return non-zero on error
+static int
+file_uri_stamp(const SordNode* const file, LilvFileStamp* const stamp)
+{
+  char* const path =
+    lilv_file_uri_parse((const char*)sord_node_get_string(file), NULL);
+
+  const int st = path ? lilv_file_stamp(path, stamp) : 1;
+  lilv_free(path);
+  return st;
+}
+
+// Record the current stamp of a loaded file in a bundle
+static int
+add_stamp(BundleFiles* const record, const SordNode* const file)
+{
+  LilvFileStamp stamp = {0, 0U};
+  if (file_uri_stamp(file, &stamp)) {
+    return 0; // Not a local file, so changes can't be detected anyway
+  }
+
+  if (!record->stamps && !(record->stamps = lilv_file_stamp_hash_new())) {
+    return 1;
+  }
+
+  FileStamp* const file_stamp =
+    lilv_file_stamp_hash_insert(record->stamps, file);
+  if (!file_stamp) {
+    return 1;
+  }
+
+  file_stamp->stamp = stamp;
+  return 0;
+}
+
+// Return the record for the added bundle that contains a file, or null
+static BundleFiles*
+find_bundle(const FileIndex* const index,
+            SordWorld* const       world,
+            const SordNode* const  file)
+{
+  if (!zix_hash_size(index->bundles)) {
+    return NULL;
+  }
+
+  char* const  prefix = lilv_strdup((const char*)sord_node_get_string(file));
+  BundleFiles* result = NULL;
+  for (char* sep = strrchr(prefix, '/'); sep && !result;
+       sep       = strrchr(prefix, '/')) {
+    sep[1] = '\0';
+
+    SordNode* const bundle = sord_new_uri(world, (uint8_t*)prefix);
+    result = zix_hash_find_record(index->bundles, bundle);
+    sord_node_free(world, bundle);
+
+    sep[0] = '\0';
+  }
+
+  free(prefix);
+  return result;
+}
+
+const SordNode*
+lilv_file_index_find_bundle(const FileIndex* const index,
+                            SordWorld* const       world,
+                            const SordNode* const  file)
+{
+  const BundleFiles* const record = find_bundle(index, world, file);
+  return record ? record->bundle : NULL;
+}
+
+FileIndex*
+lilv_file_index_new(void)
+{
+  FileIndex* const index = (FileIndex*)calloc(1, sizeof(FileIndex));
+  if (index) {
+    index->bundles = zix_hash_new(
+      NULL, record_bundle, lilv_node_ptr_hash, lilv_node_ptr_equal);
+    index->orphans = lilv_node_hash_new(NULL);
+    if (!index->bundles || !index->orphans) {
+      zix_hash_free(index->bundles);
+      lilv_node_hash_free(index->orphans, NULL);
+      free(index);
+      return NULL;
+    }
+  }
+
+  return index;
+}
+
+void
+lilv_file_index_free(FileIndex* const index, SordWorld* const world)
+{
+  if (index) {
+    for (ZixHashIter i = zix_hash_begin(index->bundles);
+         i != zix_hash_end(index->bundles);
+         i = zix_hash_next(index->bundles, i)) {
+      BundleFiles* const record = zix_hash_get(index->bundles, i);
+      lilv_file_stamp_hash_free(record->stamps, world);
+      lilv_node_hash_free(record->files, world);
+      sord_node_free(world, record->bundle);
+      free(record);
+    }
+
+    zix_hash_free(index->bundles);
+    lilv_node_hash_free(index->orphans, world);
+    free(index);
+  }
+}
+
+int
+lilv_file_index_add_bundle(FileIndex* const index, const SordNode* const bundle)
+{
+  const ZixHashInsertPlan plan   = zix_hash_plan_insert(index->bundles, bundle);
+  BundleFiles*            record = zix_hash_record_at(index->bundles, plan);
+  if (record) {
+    return 0;
+  }
+
+  if (!(record = (BundleFiles*)calloc(1, sizeof(BundleFiles)))) {
+    return 1;
+  }
+
+  record->bundle = (SordNode*)bundle;
+  if (zix_hash_insert_at(index->bundles, plan, record)) {
+    free(record);
+    return 1;
+  }
+
+  sord_node_copy(bundle);
+  return 0;
+}
+
+int
+lilv_file_index_add_file(FileIndex* const      index,
+                         SordWorld* const      world,
+                         const SordNode* const file)
+{
+  BundleFiles* const record = find_bundle(index, world, file);
+  if (record && !record->files && !(record->files = lilv_node_hash_new(NULL))) {
+    return 1;
+  }
+
+  // Record (or update) the stamp, since the file may be loaded again
+  if (record && add_stamp(record, file)) {
+    return 1;
+  }
+
+  NodeHash* const files = record ? record->files : index->orphans;
+  if (node_hash_contains(files, file)) {
+    return 0;
+  }
+
+  return lilv_node_hash_insert_copy(files, file);
+}
+
+void
+lilv_file_index_remove_file(FileIndex* const      index,
+                            SordWorld* const      world,
+                            const SordNode* const file)
+{
+  BundleFiles* const record = find_bundle(index, world, file);
+  if (record && record->files) {
+    if (record->stamps) {
+      lilv_file_stamp_hash_remove(record->stamps, world, file);
+    }
+
+    lilv_node_hash_remove(record->files, world, file);
+  }
+
+  // The file may have been loaded before its bundle was added
+  lilv_node_hash_remove(index->orphans, world, file);
+}
+
+NodeHash*
+lilv_file_index_remove_bundle(FileIndex* const      index,
+                              SordWorld* const      world,
+                              const SordNode* const bundle)
+{
+  // Take the indexed files from the bundle record
+  NodeHash*    result  = NULL;
+  BundleFiles* removed = NULL;
+  if (!zix_hash_remove(index->bundles, bundle, &removed)) {
+    lilv_file_stamp_hash_free(removed->stamps, world);
+    result = removed->files;
+    sord_node_free(world, removed->bundle);
+    free(removed);
+  }
+
+  // Add any other files in the bundle that were loaded before it was added
+  NODE_HASH_FOREACH (i, index->orphans) {
+    const SordNode* const file = lilv_node_hash_get(index->orphans, i);
+    if (file_is_in_bundle(file, bundle) &&
+        (result || (result = lilv_node_hash_new(NULL))) &&
+        !node_hash_contains(result, file)) {
+      lilv_node_hash_insert_copy(result, file);
+    }
+  }
+
+  // Remove those files from the orphans (now that iteration is finished)
+  NODE_HASH_FOREACH (i, result) {
+    lilv_node_hash_remove(index->orphans, world, lilv_node_hash_get(result, i));
+  }
+
+  return result;
+}
+
+bool
+lilv_file_index_bundle_changed(const FileIndex* const index,
+                               const SordNode* const  bundle)
+{
+  const BundleFiles* const record =
+    zix_hash_find_record(index->bundles, bundle);
+
+  if (record && record->stamps) {
+    FILE_STAMP_HASH_FOREACH (i, record->stamps) {
+      const FileStamp* const file_stamp =
+        lilv_file_stamp_hash_get(record->stamps, i);
+
+      LilvFileStamp stamp = {0, 0U};
+      if (file_uri_stamp(file_stamp->file, &stamp) ||
+          !lilv_file_stamp_equals(&stamp, &file_stamp->stamp)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_FILE_INDEX_H
+#define LILV_FILE_INDEX_H
+
+#include "node_hash.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+
+/**
+   An index of loaded files by the bundle that contains them.
+
+   This allows the files loaded from a bundle to be found without searching
+   every loaded file.  A file is indexed under the bundle whose URI is the
+   longest prefix of the file URI, if that bundle was added before the file.
+   Other files are kept in a separate set that is searched the old way.
+*/
+typedef struct FileIndexImpl FileIndex;
+
+/// Return a new empty file index
+FileIndex* ZIX_ALLOCATED
+lilv_file_index_new(void);
+
+/// Free a file index
+void
+lilv_file_index_free(FileIndex* ZIX_NULLABLE index,
+                     SordWorld* ZIX_NONNULL  world);
+
+/// Add a bundle so files loaded from it will be indexed under it
+int
+lilv_file_index_add_bundle(FileIndex* ZIX_NONNULL      index,
+                           const SordNode* ZIX_NONNULL bundle);
+
+/// Return the added bundle that contains a file, or null
+const SordNode* ZIX_NULLABLE
+lilv_file_index_find_bundle(const FileIndex* ZIX_NONNULL index,
+                            SordWorld* ZIX_NONNULL       world,
+                            const SordNode* ZIX_NONNULL  file);
+
+/// Add a loaded file
+int
+lilv_file_index_add_file(FileIndex* ZIX_NONNULL      index,
+                         SordWorld* ZIX_NONNULL      world,
+                         const SordNode* ZIX_NONNULL file);
+
+/// Remove a loaded file
+void
+lilv_file_index_remove_file(FileIndex* ZIX_NONNULL      index,
+                            SordWorld* ZIX_NONNULL      world,
+                            const SordNode* ZIX_NONNULL file);
+
+/**
+   Remove a bundle and all the files in it.
+
+   @return A hash of the removed files which must be freed by the caller, or
+   null if there were none.
+*/
+NodeHash* ZIX_ALLOCATED
+lilv_file_index_remove_bundle(FileIndex* ZIX_NONNULL      index,
+                              SordWorld* ZIX_NONNULL      world,
+                              const SordNode* ZIX_NONNULL bundle);
+
+/**
+   Return whether any loaded file in a bundle has changed since it was loaded.
+
+   This checks the stamps of every file that was loaded from the bundle
+   (including the manifest and any data files), so data files that are edited
+   in place are detected even though the bundle directory doesn't change.
+*/
+bool
+lilv_file_index_bundle_changed(const FileIndex* ZIX_NONNULL index,
+                               const SordNode* ZIX_NONNULL  bundle);
+
+#endif // LILV_FILE_INDEX_H
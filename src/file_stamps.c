@@ -0,0 +1,114 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE FileStamp
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "file_stamps.h"
+
+#include "node_hash.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+
+#include <stdlib.h>
+
+ZIX_PURE_FUNC static const SordNode*
+file_stamp_file(const FileStamp* const record)
+{
+  return record->file;
+}
+
+static void
+file_stamp_free(SordWorld* const world, FileStamp* const record)
+{
+  if (record) {
+    sord_node_free(world, record->file);
+    free(record);
+  }
+}
+
+FileStampHash*
+lilv_file_stamp_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, file_stamp_file, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_file_stamp_hash_free(FileStampHash* const hash, SordWorld* const world)
+{
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      file_stamp_free(world, zix_hash_get(hash, i));
+    }
+  }
+
+  zix_hash_free(hash);
+}
+
+FileStamp*
+lilv_file_stamp_hash_find(const FileStampHash* const hash,
+                          const SordNode* const      file)
+{
+  return zix_hash_find_record(hash, file);
+}
+
+FileStamp*
+lilv_file_stamp_hash_insert(FileStampHash* const  hash,
+                            const SordNode* const file)
+{
+  const ZixHashInsertPlan plan   = zix_hash_plan_insert(hash, file);
+  FileStamp*              record = zix_hash_record_at(hash, plan);
+  if (!record && (record = (FileStamp*)calloc(1, sizeof(FileStamp)))) {
+    record->file = (SordNode*)file;
+    if (zix_hash_insert_at(hash, plan, record)) {
+      free(record);
+      return NULL;
+    }
+
+    sord_node_copy(file);
+  }
+
+  return record;
+}
+
+void
+lilv_file_stamp_hash_remove(FileStampHash* const  hash,
+                            SordWorld* const      world,
+                            const SordNode* const file)
+{
+  FileStamp* removed = NULL;
+  if (!zix_hash_remove(hash, file, &removed)) {
+    file_stamp_free(world, removed);
+  }
+}
+
+FileStampHashIter
+lilv_file_stamp_hash_begin(const FileStampHash* const hash)
+{
+  return zix_hash_begin(hash);
+}
+
+FileStampHashIter
+lilv_file_stamp_hash_end(const FileStampHash* const hash)
+{
+  return zix_hash_end(hash);
+}
+
+FileStamp*
+lilv_file_stamp_hash_get(const FileStampHash* const hash,
+                         const FileStampHashIter    i)
+{
+  return zix_hash_get(hash, i);
+}
+
+FileStampHashIter
+lilv_file_stamp_hash_next(const FileStampHash* const hash,
+                          const FileStampHashIter    i)
+{
+  return zix_hash_next(hash, i);
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_FILE_STAMPS_H
+#define LILV_FILE_STAMPS_H
+
+#include "sys_util.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stddef.h>
+
+/// The stamp of a loaded file when it was loaded
+typedef struct {
+  SordNode* ZIX_NONNULL file;  ///< File URI
+  LilvFileStamp         stamp; ///< Stamp of file when it was loaded
+} FileStamp;
+
+typedef struct ZixHashImpl FileStampHash;
+typedef size_t             FileStampHashIter;
+
+#define FILE_STAMP_HASH_FOREACH(fs_iter, fs_hash)                          \
+  /* NOLINTNEXTLINE(bugprone-macro-parentheses) */                         \
+  for (FileStampHashIter fs_iter = lilv_file_stamp_hash_begin(fs_hash);    \
+       (fs_iter) != lilv_file_stamp_hash_end(fs_hash);                     \
+       (fs_iter) = lilv_file_stamp_hash_next(fs_hash, fs_iter))
+
+/// Return a new empty hash of file stamps keyed by interned file URI
+FileStampHash* ZIX_ALLOCATED
+lilv_file_stamp_hash_new(void);
+
+/// Free a file stamp hash and all the records in it
+void
+lilv_file_stamp_hash_free(FileStampHash* ZIX_NULLABLE hash,
+                          SordWorld* ZIX_NONNULL      world);
+
+/// Return the record for a file, or null
+FileStamp* ZIX_NULLABLE
+lilv_file_stamp_hash_find(const FileStampHash* ZIX_NONNULL hash,
+                          const SordNode* ZIX_NONNULL      file);
+
+/// Return the record for a file, adding a new one if necessary
+FileStamp* ZIX_NULLABLE
+lilv_file_stamp_hash_insert(FileStampHash* ZIX_NONNULL  hash,
+                            const SordNode* ZIX_NONNULL file);
+
+/// Remove and free the record for a file
+void
+lilv_file_stamp_hash_remove(FileStampHash* ZIX_NONNULL  hash,
+                            SordWorld* ZIX_NONNULL      world,
+                            const SordNode* ZIX_NONNULL file);
+
+/// Return an iterator to the first record in a hash, or the end if it is empty
+ZIX_PURE_FUNC FileStampHashIter
+lilv_file_stamp_hash_begin(const FileStampHash* ZIX_NONNULL hash);
+
+/// Return an iterator one past the last possible record in the hash
+ZIX_PURE_FUNC FileStampHashIter
+lilv_file_stamp_hash_end(const FileStampHash* ZIX_NONNULL hash);
+
+/// Return the record at the given position
+ZIX_PURE_FUNC FileStamp* ZIX_UNSPECIFIED
+lilv_file_stamp_hash_get(const FileStampHash* ZIX_NONNULL hash,
+                         FileStampHashIter                i);
+
+/// Return an iterator that has been advanced to the next record
+ZIX_PURE_FUNC FileStampHashIter
+lilv_file_stamp_hash_next(const FileStampHash* ZIX_NONNULL hash,
+                          FileStampHashIter                i);
+
+#endif // LILV_FILE_STAMPS_H
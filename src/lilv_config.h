@@ -30,4 +30,22 @@
 #  endif
 #endif
 
+// Use inotify to watch for changes to installed bundles
+#ifndef LILV_USE_INOTIFY
+#  if defined(__linux__)
+#    define LILV_USE_INOTIFY 1
+#  else
+#    define LILV_USE_INOTIFY 0
+#  endif
+#endif
+
+// Use mmap to read data files
+#ifndef LILV_USE_MMAP
+#  if defined(__linux__)
+#    define LILV_USE_MMAP 1
+#  else
+#    define LILV_USE_MMAP 0
+#  endif
+#endif
+
 #endif // LILV_CONFIG_H
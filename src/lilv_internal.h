@@ -8,13 +8,26 @@
 extern "C" {
 #endif
 
+#include "bundles.h"
+#include "cache.h"
+#include "feature_hash.h"
+#include "file_index.h"
 #include "node_hash.h"
+#include "node_pool.h"
+#include "plugin_hash.h"
+#include "port_hash.h"
+#include "query_cache.h"
+#include "search.h"
+#include "stats.h"
 #include "uris.h"
+#include "versions.h"
+#include "watcher.h"
 
 #include <lilv/lilv.h>
 #include <lv2/core/lv2.h>
 #include <serd/serd.h>
 #include <sord/sord.h>
+#include <zix/status.h>
 #include <zix/tree.h>
 
 #include <stdbool.h>
@@ -30,19 +43,58 @@ extern "C" {
  *
  */
 
-typedef void LilvCollection;
+/// A collection of pointers, used to implement all public collection types
+typedef struct LilvCollectionImpl LilvCollection;
+
+/// A comparator for sorted collections
+typedef int (*LilvCompareFunc)(const void* a,
+                               const void* b,
+                               const void* user_data);
+
+/// Flags for well-known port classes
+typedef enum {
+  LILV_PORT_CLASS_INPUT   = 1U << 0U, ///< lv2:InputPort
+  LILV_PORT_CLASS_OUTPUT  = 1U << 1U, ///< lv2:OutputPort
+  LILV_PORT_CLASS_AUDIO   = 1U << 2U, ///< lv2:AudioPort
+  LILV_PORT_CLASS_CONTROL = 1U << 3U, ///< lv2:ControlPort
+  LILV_PORT_CLASS_CV      = 1U << 4U, ///< lv2:CVPort
+  LILV_PORT_CLASS_ATOM    = 1U << 5U, ///< atom:AtomPort
+  LILV_PORT_CLASS_EVENT   = 1U << 6U, ///< ev:EventPort
+} LilvPortClassFlag;
+
+/// The scale points of a port, sorted for lookup by value or label
+typedef struct {
+  LilvScalePoints* points;   ///< All points sorted by value, or NULL
+  LilvScalePoint** by_value; ///< Points sorted by numeric value
+  LilvScalePoint** by_label; ///< Points sorted by label
+  unsigned         n_points; ///< Number of points
+} ScalePointIndex;
 
 struct LilvPortImpl {
-  LilvNode*  node;    ///< RDF node
-  uint32_t   index;   ///< lv2:index
-  LilvNode*  symbol;  ///< lv2:symbol
-  LilvNodes* classes; ///< rdf:type
+  LilvNode*        node;         ///< RDF node
+  uint32_t         index;        ///< lv2:index
+  LilvNode*        symbol;       ///< lv2:symbol
+  LilvNodes*       classes;      ///< rdf:type
+  uint32_t         class_flags;  ///< Well-known classes (LilvPortClassFlag)
+  uint32_t         properties;   ///< Well-known properties (LilvPortProperty)
+  float            def;          ///< lv2:default, or NAN
+  float            min;          ///< lv2:minimum, or NAN
+  float            max;          ///< lv2:maximum, or NAN
+  const LilvNode*  designation;  ///< First lv2:designation (owned by plugin)
+  ScalePointIndex* scale_points; ///< Scale points, or NULL if not loaded
 };
 
+/// A port designation, owned by the plugin
+typedef struct {
+  LilvNode* designation; ///< Value of lv2:designation
+  LilvPort* port;        ///< Port with this designation
+} PortDesignation;
+
 typedef struct LilvSpecImpl {
   SordNode*            spec;
   SordNode*            bundle;
   LilvNodes*           data_uris;
+  bool                 loaded;
   struct LilvSpecImpl* next;
 } LilvSpec;
 
@@ -86,8 +138,19 @@ struct LilvPluginImpl {
   const LilvPluginClass* plugin_class;
   LilvNodes*             data_uris; ///< rdfs::seeAlso
   LilvPort**             ports;
+  LilvPortInfo*          port_table;     ///< Summary of ports, built on demand
+  float*                 port_ranges;    ///< Port minimums, maximums, defaults
+  PortHash*              port_index;     ///< Ports keyed by symbol
+  PortDesignation*       designations;   ///< Port designations by port index
+  size_t                 n_designations; ///< Number of port designations
+  uint32_t               latency_port;   ///< Latency port index, or UINT32_MAX
+  uint64_t*              class_set;      ///< Ancestors of all plugin classes
+  unsigned               class_epoch;    ///< Class index epoch of class_set
+  FeatureBits            required;       ///< lv2:requiredFeature IDs
+  FeatureBits            optional;       ///< lv2:optionalFeature IDs
   uint32_t               num_ports;
   bool                   loaded;
+  bool                   loaded_features;
   bool                   parse_errors;
   bool                   replaced;
 };
@@ -97,6 +160,23 @@ struct LilvPluginClassImpl {
   LilvNode*  uri;
   LilvNode*  parent_uri;
   LilvNode*  label;
+  uint32_t   id; ///< Index in the world's class index, or UINT32_MAX
+};
+
+/// Dense index of plugin classes, rebuilt whenever classes are loaded
+typedef struct {
+  LilvPluginClass** classes;     ///< Classes sorted by URI, indexed by ID
+  LilvPluginClass** children;    ///< Children of all classes, grouped by parent
+  uint32_t*         first_child; ///< Offset of the children of each class
+  uint64_t*         ancestors;   ///< Transitive ancestors of each class
+  uint32_t          n_classes;   ///< Number of classes
+  uint32_t          n_words;     ///< Number of words in an ancestor set
+  unsigned          epoch;       ///< Incremented every time index is built
+} ClassIndex;
+
+struct LilvFeatureSetImpl {
+  LilvWorld*  world;
+  FeatureBits features;
 };
 
 struct LilvInstancePimpl {
@@ -105,10 +185,15 @@ struct LilvInstancePimpl {
 };
 
 typedef struct {
-  bool  dyn_manifest;
-  bool  filter_lang;
-  bool  object_index;
-  char* lv2_path;
+  char*    cache_dir;
+  unsigned discovery_threads;
+  bool     dyn_manifest;
+  bool     filter_lang;
+  bool     lazy_specs;
+  bool     mmap;
+  bool     object_index;
+  bool     stats;
+  char*    lv2_path;
 } LilvOptions;
 
 struct LilvWorldImpl {
@@ -119,14 +204,34 @@ struct LilvWorldImpl {
   unsigned           n_read_files;
   LilvPluginClass*   lv2_plugin_class;
   LilvPluginClasses* plugin_classes;
+  ClassIndex         class_index;
   LilvSpec*          specs;
   LilvPlugins*       plugins;
   LilvPlugins*       zombies;
+  PluginHash*        plugin_index;
+  NodePool*          shared_nodes;
+  FeatureHash*       features;
+  SearchIndex*       search_index;
+  QueryCache*        query_cache;
+  unsigned           generation; ///< Incremented when the model changes
   NodeHash*          loaded_files;
+  FileIndex*         file_index;
   NodeHash*          replaced;
+  BundleHash*        bundles;
+  VersionHash*       versions;
   ZixTree*           libs;
   SordModel*         applications;
   SordModel*         subclasses;
+  Cache*             cache;
+  Watcher*           watcher;
+  NodeHash*          changed_bundles;
+  SordNode**         change_queue;
+  unsigned           n_queued_changes;
+  bool               lost_changes;
+  bool               stale_classes;
+  StatsHash*         bundle_stats;
+  StatsHash*         file_stats;
+  LilvWorldStats     stats;
   LilvURIs           uris;
   LilvOptions        opt;
 };
@@ -155,6 +260,7 @@ struct LilvNodeImpl {
 struct LilvScalePointImpl {
   LilvNode* value;
   LilvNode* label;
+  float     number; ///< Numeric value, or NAN
 };
 
 struct LilvUIImpl {
@@ -165,11 +271,6 @@ struct LilvUIImpl {
   LilvNodes* classes;
 };
 
-typedef struct LilvVersion {
-  int minor;
-  int micro;
-} LilvVersion;
-
 /*
  *
  * Functions
@@ -184,6 +285,15 @@ lilv_port_new(LilvWorld*      world,
 void
 lilv_port_free(const LilvPlugin* plugin, LilvPort* port);
 
+uint32_t
+lilv_port_class_flag(const LilvWorld* world, const SordNode* port_class);
+
+uint32_t
+lilv_port_property_flag(const LilvWorld* world, const SordNode* property);
+
+void
+lilv_port_add_class(LilvWorld* world, LilvPort* port, const SordNode* type);
+
 LilvPlugin*
 lilv_plugin_new(LilvWorld* world, LilvNode* uri, LilvNode* bundle_uri);
 
@@ -196,6 +306,9 @@ lilv_plugin_load_if_necessary(const LilvPlugin* plugin);
 void
 lilv_plugin_free(LilvPlugin* plugin);
 
+void
+lilv_plugin_free_port_caches(LilvPlugin* plugin);
+
 const SordNode*
 lilv_plugin_get_unique_internal(const LilvPlugin* plugin,
                                 const SordNode*   subject,
@@ -206,9 +319,29 @@ lilv_plugin_get_unique(const LilvPlugin* plugin,
                        const SordNode*   subject,
                        const SordNode*   predicate);
 
+/// Return a new bitset of all the classes of a plugin and their ancestors
+uint64_t*
+lilv_plugin_new_class_set(const LilvPlugin* plugin);
+
 void*
 lilv_collection_get(const LilvCollection* collection, const LilvIter* i);
 
+/// Return the element at `index` in a collection, or null
+void*
+lilv_collection_get_at(const LilvCollection* collection, unsigned index);
+
+/// Insert an element (taking ownership), or fail if an equal one exists
+ZixStatus
+lilv_collection_insert(LilvCollection* collection, void* element);
+
+/// Remove and return the element at `index` without freeing it
+void*
+lilv_collection_remove_at(LilvCollection* collection, unsigned index);
+
+/// Remove and return the element with the given URI without freeing it
+struct LilvHeader*
+lilv_collection_remove_by_uri(LilvCollection* collection, const LilvNode* uri);
+
 LilvPluginClass*
 lilv_plugin_class_new(LilvWorld*      world,
                       const SordNode* parent_node,
@@ -239,9 +372,16 @@ lilv_plugins_new(void);
 LilvScalePoints*
 lilv_scale_points_new(void);
 
+LilvScalePoints*
+lilv_scale_points_new_sorted(void);
+
 LilvPluginClasses*
 lilv_plugin_classes_new(void);
 
+/// Return a new collection of plugin classes that doesn't own its elements
+LilvPluginClasses*
+lilv_plugin_classes_new_view(void);
+
 LilvUIs*
 lilv_uis_new(void);
 
@@ -250,6 +390,21 @@ lilv_world_get_unique(LilvWorld*      world,
                       const SordNode* subject,
                       const SordNode* predicate);
 
+/// Build plugin classes if they were deferred by lazy specification loading
+void
+lilv_world_update_plugin_classes(LilvWorld* world);
+
+/// Load any lazy specifications that define terms in a query pattern
+void
+lilv_world_load_specs_for(LilvWorld*      world,
+                          const SordNode* subject,
+                          const SordNode* predicate,
+                          const SordNode* object);
+
+/// Return the loaded plugin class with the given URI, or NULL
+const LilvPluginClass*
+lilv_world_find_plugin_class(const LilvWorld* world, const SordNode* uri);
+
 const uint8_t*
 lilv_world_blank_node_prefix(LilvWorld* world);
 
@@ -274,6 +429,21 @@ lilv_node_new(LilvWorld* world, LilvNodeType type, const char* str);
 LilvNode*
 lilv_node_new_from_node(LilvWorld* world, const SordNode* node);
 
+/**
+   Initialize a node on the stack for a Sord node, for passing to callbacks.
+
+   The view is normalized exactly like lilv_node_new_from_node(), so literals
+   lose any language tag and unknown datatype.  This usually only copies a
+   reference to `node`, but may intern a new literal, so the view must be
+   released with lilv_node_clear_view().
+*/
+void
+lilv_node_init_view(LilvNode* view, LilvWorld* world, const SordNode* node);
+
+/// Release the node referenced by a view made with lilv_node_init_view()
+void
+lilv_node_clear_view(LilvNode* view);
+
 int
 lilv_header_compare_by_uri(const void* a, const void* b, const void* user_data);
 
@@ -298,7 +468,8 @@ lilv_version_cmp(const LilvVersion* a, const LilvVersion* b)
 }
 
 struct LilvHeader*
-lilv_collection_get_by_uri(const ZixTree* seq, const LilvNode* uri);
+lilv_collection_get_by_uri(const LilvCollection* collection,
+                           const LilvNode*       uri);
 
 LilvScalePoint*
 lilv_scale_point_new(LilvWorld*      world,
@@ -308,6 +479,9 @@ lilv_scale_point_new(LilvWorld*      world,
 void
 lilv_scale_point_free(LilvScalePoint* point);
 
+int
+lilv_scale_point_cmp(const void* a, const void* b, const void* user_data);
+
 #ifdef LILV_DYN_MANIFEST
 static const LV2_Feature* const dman_features = {NULL};
 
@@ -47,18 +47,31 @@ on_statement(LoadSkimmer* const       skimmer,
     return SERD_ERR_BAD_ARG;
   }
 
-  // Call skim function and add statement to model if it wasn't dropped
-  SerdStatus st = skimmer->skim(skimmer->skim_handle, s, p, o);
-  if (!st) {
-    const SordQuad tup = {s, p, o, g};
-    sord_add(skimmer->model, tup);
-  }
+  const SerdStatus st = load_skimmer_add(skimmer, s, p, o, g);
 
   sord_node_free(world, o);
   sord_node_free(world, p);
   sord_node_free(world, s);
   sord_node_free(world, g);
 
+  return st;
+}
+
+SerdStatus
+load_skimmer_add(LoadSkimmer* const    skimmer,
+                 const SordNode* const subject,
+                 const SordNode* const predicate,
+                 const SordNode* const object,
+                 const SordNode* const graph)
+{
+  // Call skim function and add statement to model if it wasn't dropped
+  const SerdStatus st =
+    skimmer->skim(skimmer->skim_handle, subject, predicate, object);
+  if (!st) {
+    const SordQuad tup = {subject, predicate, object, graph};
+    sord_add(skimmer->model, tup);
+  }
+
   return (st > SERD_FAILURE) ? st : SERD_SUCCESS;
 }
 
@@ -39,6 +39,14 @@ load_skimmer_init(LoadSkimmer* ZIX_NONNULL    skimmer,
                   void* ZIX_UNSPECIFIED       skim_handle,
                   LoadSkimmerFunc ZIX_NONNULL skim);
 
+/// Skim a statement then add it to the model if it wasn't dropped
+SerdStatus
+load_skimmer_add(LoadSkimmer* ZIX_NONNULL     skimmer,
+                 const SordNode* ZIX_NONNULL  subject,
+                 const SordNode* ZIX_NONNULL  predicate,
+                 const SordNode* ZIX_NONNULL  object,
+                 const SordNode* ZIX_NULLABLE graph);
+
 void
 load_skimmer_cleanup(LoadSkimmer* ZIX_NONNULL skimmer);
 
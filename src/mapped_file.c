@@ -0,0 +1,171 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "mapped_file.h"
+
+#include "lilv_config.h"
+
+#include <lilv/lilv.h>
+#include <serd/serd.h>
+
+#if LILV_USE_MMAP
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if LILV_USE_MMAP
+
+int
+lilv_mapped_file_open(MappedFile* const file, const char* const path)
+{
+  file->data = NULL;
+  file->size = 0U;
+
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return errno;
+  }
+
+  // Only map regular files, since special files may not have a fixed size
+  struct stat st;
+  if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+    close(fd);
+    return EINVAL;
+  }
+
+  const size_t size = (size_t)st.st_size;
+  void* const  data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return errno;
+  }
+
+  // The file is read once from start to end, so read ahead aggressively
+  posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+  file->data = (const char*)data;
+  file->size = size;
+  return 0;
+}
+
+// Return true if the file at `path` is still at least as large as `file`
+static bool
+mapped_file_is_intact(const MappedFile* const file, const char* const path)
+{
+  struct stat st;
+  return !stat(path, &st) && st.st_size >= 0 &&
+         (size_t)st.st_size >= file->size;
+}
+
+void
+lilv_mapped_file_close(MappedFile* const file)
+{
+  if (file->data) {
+    munmap((void*)file->data, file->size);
+    file->data = NULL;
+    file->size = 0U;
+  }
+}
+
+#else // !LILV_USE_MMAP
+
+static bool
+mapped_file_is_intact(const MappedFile* const file, const char* const path)
+{
+  (void)file;
+  (void)path;
+  return false;
+}
+
+int
+lilv_mapped_file_open(MappedFile* const file, const char* const path)
+{
+  (void)path;
+
+  file->data = NULL;
+  file->size = 0U;
+  return ENOSYS;
+}
+
+void
+lilv_mapped_file_close(MappedFile* const file)
+{
+  (void)file;
+}
+
+#endif // LILV_USE_MMAP
+
+/// A stream of bytes in memory, read like a file by serd
+typedef struct {
+  const char* data;   ///< Start of data
+  size_t      size;   ///< Size of data in bytes
+  size_t      offset; ///< Current read offset
+} MemorySource;
+
+static size_t
+memory_source_read(void* const  buf,
+                   const size_t size,
+                   const size_t nmemb,
+                   void* const  stream)
+{
+  MemorySource* const source    = (MemorySource*)stream;
+  const size_t        remaining = source->size - source->offset;
+  const size_t        max_items = size ? remaining / size : 0U;
+  const size_t        n_items   = nmemb < max_items ? nmemb : max_items;
+  const size_t        n_bytes   = n_items * size;
+
+  memcpy(buf, source->data + source->offset, n_bytes);
+  source->offset += n_bytes;
+  return n_items;
+}
+
+static int
+memory_source_error(void* const stream)
+{
+  (void)stream;
+  return 0;
+}
+
+SerdStatus
+lilv_mapped_file_read(SerdReader* const    reader,
+                      const uint8_t* const uri,
+                      const bool           map)
+{
+  if (!map) {
+    return serd_reader_read_file(reader, uri);
+  }
+
+  char* const path = lilv_file_uri_parse((const char*)uri, NULL);
+  MappedFile  file = {NULL, 0U};
+  if (!path || lilv_mapped_file_open(&file, path)) {
+    lilv_free(path);
+    return serd_reader_read_file(reader, uri);
+  }
+
+  // Check the size again to avoid reading past the end of a truncated file
+  if (!mapped_file_is_intact(&file, path)) {
+    lilv_mapped_file_close(&file);
+    lilv_free(path);
+    return serd_reader_read_file(reader, uri);
+  }
+
+  MemorySource     source = {file.data, file.size, 0U};
+  const SerdStatus st     = serd_reader_read_source(reader,
+                                                    memory_source_read,
+                                                    memory_source_error,
+                                                    &source,
+                                                    (const uint8_t*)path,
+                                                    4096U);
+
+  lilv_mapped_file_close(&file);
+  lilv_free(path);
+  return st;
+}
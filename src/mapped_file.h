@@ -0,0 +1,52 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_MAPPED_FILE_H
+#define LILV_MAPPED_FILE_H
+
+#include <serd/serd.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// The contents of a regular file mapped into memory
+typedef struct {
+  const char* ZIX_NULLABLE data; ///< Start of file contents
+  size_t                   size; ///< Size of file contents in bytes
+} MappedFile;
+
+/**
+   Map the contents of the file at `path` into memory.
+
+   This only works for non-empty regular files, and returns non-zero for
+   anything else (or if mapping isn't supported) so the caller can fall back to
+   reading the file normally.
+
+   The mapping is only valid as long as the file isn't truncated: if another
+   process shrinks the file while it's mapped, then accessing the lost pages
+   raises SIGBUS, which can't be detected or recovered from here.
+*/
+int
+lilv_mapped_file_open(MappedFile* ZIX_NONNULL file,
+                      const char* ZIX_NONNULL path);
+
+/// Unmap a file opened with lilv_mapped_file_open()
+void
+lilv_mapped_file_close(MappedFile* ZIX_NONNULL file);
+
+/**
+   Read a file with a serd reader, mapping it into memory if possible.
+
+   If `map` is true and the file can be mapped, then it's fed to serd from
+   memory, which avoids the system calls and copying of reading it page by
+   page.  Otherwise, or if the file seems to have shrunk since it was mapped,
+   it's read normally with stdio.
+*/
+SerdStatus
+lilv_mapped_file_read(SerdReader* ZIX_NONNULL    reader,
+                      const uint8_t* ZIX_NONNULL uri,
+                      bool                       map);
+
+#endif // LILV_MAPPED_FILE_H
@@ -99,6 +99,78 @@ lilv_node_new(LilvWorld* world, LilvNodeType type, const char* str)
   return val;
 }
 
+/// Return the type of a LilvNode for a Sord literal
+static LilvNodeType
+lilv_node_literal_type(const LilvWorld* world, const SordNode* node)
+{
+  const SordNode* const datatype_uri = sord_node_get_datatype(node);
+  if (!datatype_uri) {
+    return LILV_VALUE_STRING;
+  }
+
+  if (sord_node_equals(datatype_uri, world->uris.xsd_boolean)) {
+    return LILV_VALUE_BOOL;
+  }
+
+  if (sord_node_equals(datatype_uri, world->uris.xsd_decimal) ||
+      sord_node_equals(datatype_uri, world->uris.xsd_double) ||
+      sord_node_equals(datatype_uri, world->uris.xsd_float)) {
+    return LILV_VALUE_FLOAT;
+  }
+
+  if (sord_node_equals(datatype_uri, world->uris.xsd_integer)) {
+    return LILV_VALUE_INT;
+  }
+
+  if (sord_node_equals(datatype_uri, world->uris.xsd_base64Binary)) {
+    return LILV_VALUE_BLOB;
+  }
+
+  LILV_ERRORF("Unknown datatype <%s>\n", sord_node_get_string(datatype_uri));
+  return LILV_VALUE_STRING;
+}
+
+/**
+   Return a new reference to a literal like the one lilv_node_new() makes.
+
+   The literal keeps its string, but loses any language tag, and its datatype
+   is replaced by the one lilv_node_new() uses for `type`.  If it's already like
+   that, then it's simply copied without allocating anything.
+*/
+static SordNode*
+lilv_node_normalize_literal(LilvWorld* const      world,
+                            const SordNode* const node,
+                            const LilvNodeType    type)
+{
+  const SordNode* datatype = NULL;
+  switch (type) {
+  case LILV_VALUE_URI:
+  case LILV_VALUE_BLANK:
+  case LILV_VALUE_STRING:
+    break;
+  case LILV_VALUE_INT:
+    datatype = world->uris.xsd_integer;
+    break;
+  case LILV_VALUE_FLOAT:
+    datatype = world->uris.xsd_decimal;
+    break;
+  case LILV_VALUE_BOOL:
+    datatype = world->uris.xsd_boolean;
+    break;
+  case LILV_VALUE_BLOB:
+    datatype = world->uris.xsd_base64Binary;
+    break;
+  }
+
+  if (!sord_node_get_language(node) &&
+      sord_node_get_datatype(node) == datatype) {
+    return sord_node_copy(node);
+  }
+
+  return sord_new_literal(
+    world->world, (SordNode*)datatype, sord_node_get_string(node), NULL);
+}
+
 // Create a new LilvNode from `node`, or return NULL if impossible
 LilvNode*
 lilv_node_new_from_node(LilvWorld* world, const SordNode* node)
@@ -107,48 +179,52 @@ lilv_node_new_from_node(LilvWorld* world, const SordNode* node)
     return NULL;
   }
 
-  LilvNode*       result       = NULL;
-  const SordNode* datatype_uri = NULL;
-  LilvNodeType    type         = LILV_VALUE_STRING;
+  LilvNode* const result = (LilvNode*)malloc(sizeof(LilvNode));
+  if (!result) {
+    return NULL;
+  }
+
+  lilv_node_init_view(result, world, node);
+  if (!result->node) {
+    free(result);
+    return NULL;
+  }
+
+  return result;
+}
+
+void
+lilv_node_init_view(LilvNode* const       view,
+                    LilvWorld* const      world,
+                    const SordNode* const node)
+{
+  view->world       = world;
+  view->val.int_val = 0;
 
   switch (sord_node_get_type(node)) {
   case SORD_URI:
-    result        = (LilvNode*)malloc(sizeof(LilvNode));
-    result->world = world;
-    result->type  = LILV_VALUE_URI;
-    result->node  = sord_node_copy(node);
+    view->type = LILV_VALUE_URI;
+    view->node = sord_node_copy(node);
     break;
   case SORD_BLANK:
-    result        = (LilvNode*)malloc(sizeof(LilvNode));
-    result->world = world;
-    result->type  = LILV_VALUE_BLANK;
-    result->node  = sord_node_copy(node);
+    view->type = LILV_VALUE_BLANK;
+    view->node = sord_node_copy(node);
     break;
   case SORD_LITERAL:
-    datatype_uri = sord_node_get_datatype(node);
-    if (datatype_uri) {
-      if (sord_node_equals(datatype_uri, world->uris.xsd_boolean)) {
-        type = LILV_VALUE_BOOL;
-      } else if (sord_node_equals(datatype_uri, world->uris.xsd_decimal) ||
-                 sord_node_equals(datatype_uri, world->uris.xsd_double) ||
-                 sord_node_equals(datatype_uri, world->uris.xsd_float)) {
-        type = LILV_VALUE_FLOAT;
-      } else if (sord_node_equals(datatype_uri, world->uris.xsd_integer)) {
-        type = LILV_VALUE_INT;
-      } else if (sord_node_equals(datatype_uri, world->uris.xsd_base64Binary)) {
-        type = LILV_VALUE_BLOB;
-      } else {
-        LILV_ERRORF("Unknown datatype <%s>\n",
-                    sord_node_get_string(datatype_uri));
-      }
+    view->type = lilv_node_literal_type(world, node);
+    view->node = lilv_node_normalize_literal(world, node, view->type);
+    if (view->node) {
+      lilv_node_set_numerics_from_string(view);
     }
-    result =
-      lilv_node_new(world, type, (const char*)sord_node_get_string(node));
-    lilv_node_set_numerics_from_string(result);
     break;
   }
+}
 
-  return result;
+void
+lilv_node_clear_view(LilvNode* const view)
+{
+  sord_node_free(view->world->world, view->node);
+  view->node = NULL;
 }
 
 LilvNode*
@@ -358,6 +434,12 @@ lilv_node_as_string(const LilvNode* value)
   return value ? (const char*)sord_node_get_string(value->node) : NULL;
 }
 
+const char*
+lilv_node_as_string_counted(const LilvNode* const value, size_t* const length)
+{
+  return (const char*)sord_node_get_string_counted(value->node, length);
+}
+
 bool
 lilv_node_is_int(const LilvNode* value)
 {
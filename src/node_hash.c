@@ -24,14 +24,14 @@ node_ptr_identity(const SordNode* const record)
   return record;
 }
 
-ZIX_PURE_FUNC static size_t
-node_ptr_hash(const SordNode* const node)
+size_t
+lilv_node_ptr_hash(const SordNode* const node)
 {
   return zix_digest_aligned(0U, &node, sizeof(SordNode*));
 }
 
-static bool
-node_ptr_equal(const SordNode* const lhs, const SordNode* const rhs)
+bool
+lilv_node_ptr_equal(const SordNode* const lhs, const SordNode* const rhs)
 {
   return lhs == rhs;
 }
@@ -40,7 +40,7 @@ NodeHash*
 lilv_node_hash_new(ZixAllocator* const allocator)
 {
   return zix_hash_new(
-    allocator, node_ptr_identity, node_ptr_hash, node_ptr_equal);
+    allocator, node_ptr_identity, lilv_node_ptr_hash, lilv_node_ptr_equal);
 }
 
 void
@@ -8,6 +8,7 @@
 #include <zix/attributes.h>
 #include <zix/status.h>
 
+#include <stdbool.h>
 #include <stddef.h>
 
 typedef struct SordWorldImpl SordWorld;
@@ -21,6 +22,15 @@ typedef size_t               NodeHashIter;
        lh_hash && ((lh_iter) != lilv_node_hash_end(lh_hash));               \
        (lh_iter) = lh_hash ? lilv_node_hash_next(lh_hash, lh_iter) : 0U)
 
+/// Return the hash code of an interned node pointer (not the node's value)
+ZIX_PURE_FUNC size_t
+lilv_node_ptr_hash(const SordNode* ZIX_NONNULL node);
+
+/// Return whether two interned node pointers are equal
+ZIX_CONST_FUNC bool
+lilv_node_ptr_equal(const SordNode* ZIX_NONNULL lhs,
+                    const SordNode* ZIX_NONNULL rhs);
+
 /// Return a new hash of interned node pointers compared by pointer value
 NodeHash* ZIX_ALLOCATED
 lilv_node_hash_new(ZixAllocator* ZIX_NULLABLE allocator);
@@ -0,0 +1,84 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE LilvNode
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "node_pool.h"
+
+#include "lilv_internal.h"
+#include "node_hash.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+ZIX_PURE_FUNC static const SordNode*
+pooled_node(const LilvNode* const node)
+{
+  return node->node;
+}
+
+NodePool*
+lilv_node_pool_new(void)
+{
+  return zix_hash_new(
+    NULL, pooled_node, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_node_pool_free(NodePool* const pool)
+{
+  if (pool) {
+    for (ZixHashIter i = zix_hash_begin(pool); i != zix_hash_end(pool);
+         i             = zix_hash_next(pool, i)) {
+      lilv_node_free(zix_hash_get(pool, i));
+    }
+  }
+
+  zix_hash_free(pool);
+}
+
+const LilvNode*
+lilv_node_pool_intern(NodePool* const       pool,
+                      LilvWorld* const      world,
+                      const SordNode* const node)
+{
+  if (!node) {
+    return NULL;
+  }
+
+  // Normalize the node first, so equal values share one pooled node
+  LilvNode view;
+  lilv_node_init_view(&view, world, node);
+  if (!view.node) {
+    return NULL;
+  }
+
+  const ZixHashInsertPlan plan     = zix_hash_plan_insert(pool, view.node);
+  const LilvNode*         existing = zix_hash_record_at(pool, plan);
+  if (existing) {
+    lilv_node_clear_view(&view);
+    return existing;
+  }
+
+  // Move the view (and its reference to the node) into the pool
+  LilvNode* const result = (LilvNode*)malloc(sizeof(LilvNode));
+  if (!result) {
+    lilv_node_clear_view(&view);
+    return NULL;
+  }
+
+  *result = view;
+  if (zix_hash_insert_at(pool, plan, result)) {
+    lilv_node_free(result);
+    return NULL;
+  }
+
+  return result;
+}
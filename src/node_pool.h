@@ -0,0 +1,39 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_NODE_POOL_H
+#define LILV_NODE_POOL_H
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+/**
+   A pool of nodes owned by the world, keyed by normalized Sord node.
+
+   This is used to return shared nodes from getters, so that each distinct
+   value is only allocated once and can be borrowed by the caller until the
+   world is freed.
+*/
+typedef struct ZixHashImpl NodePool;
+
+/// Return a new empty node pool
+NodePool* ZIX_ALLOCATED
+lilv_node_pool_new(void);
+
+/// Free a node pool and every node in it
+void
+lilv_node_pool_free(NodePool* ZIX_NULLABLE pool);
+
+/**
+   Return the shared node for a Sord node, adding it if necessary.
+
+   The node is normalized like lilv_node_new_from_node() first, so literals
+   that only differ by language tag share the same node.
+*/
+const LilvNode* ZIX_NULLABLE
+lilv_node_pool_intern(NodePool* ZIX_NONNULL        pool,
+                      LilvWorld* ZIX_NONNULL       world,
+                      const SordNode* ZIX_NULLABLE node);
+
+#endif // LILV_NODE_POOL_H
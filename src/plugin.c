@@ -5,6 +5,7 @@
 #include "log.h"
 #include "node_hash.h"
 #include "query.h"
+#include "sys_util.h"
 
 #ifdef LILV_DYN_MANIFEST
 #  include "dylib.h"
@@ -15,7 +16,6 @@
 #include <lv2/core/lv2.h>
 #include <serd/serd.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
 
 #include <assert.h>
 #include <math.h>
@@ -34,12 +34,26 @@ lilv_plugin_init(LilvPlugin* plugin, LilvNode* bundle_uri)
 #ifdef LILV_DYN_MANIFEST
   plugin->dynmanifest = NULL;
 #endif
-  plugin->plugin_class = NULL;
-  plugin->data_uris    = lilv_nodes_new();
-  plugin->ports        = NULL;
-  plugin->num_ports    = 0;
-  plugin->loaded       = false;
-  plugin->parse_errors = false;
+  plugin->plugin_class   = NULL;
+  plugin->data_uris      = lilv_nodes_new();
+  plugin->ports          = NULL;
+  plugin->port_table     = NULL;
+  plugin->port_ranges    = NULL;
+  plugin->port_index     = NULL;
+  plugin->designations   = NULL;
+  plugin->n_designations = 0U;
+  plugin->latency_port   = UINT32_MAX;
+  plugin->class_set      = NULL;
+  plugin->class_epoch    = 0U;
+  plugin->num_ports      = 0;
+  plugin->loaded         = false;
+  plugin->parse_errors   = false;
+
+  plugin->required.words   = NULL;
+  plugin->required.n_words = 0U;
+  plugin->optional.words   = NULL;
+  plugin->optional.n_words = 0U;
+  plugin->loaded_features  = false;
 }
 
 // Ownership of `uri` and `bundle` is taken
@@ -61,12 +75,45 @@ lilv_plugin_clear(LilvPlugin* plugin, LilvNode* bundle_uri)
   lilv_node_free(plugin->bundle_uri);
   lilv_node_free(plugin->binary_uri);
   lilv_nodes_free(plugin->data_uris);
+  lilv_plugin_free_port_caches(plugin);
+  lilv_port_hash_free(plugin->port_index);
+  free(plugin->class_set);
+  lilv_feature_bits_clear(&plugin->required);
+  lilv_feature_bits_clear(&plugin->optional);
   lilv_plugin_init(plugin, bundle_uri);
 }
 
+void
+lilv_plugin_free_port_caches(LilvPlugin* const plugin)
+{
+  if (plugin->port_table) {
+    for (uint32_t i = 0; i < plugin->num_ports; ++i) {
+      lilv_node_free((LilvNode*)plugin->port_table[i].buffer_type);
+    }
+    free(plugin->port_table);
+    plugin->port_table = NULL;
+  }
+
+  free(plugin->port_ranges);
+  plugin->port_ranges = NULL;
+}
+
 static void
 lilv_plugin_free_ports(LilvPlugin* plugin)
 {
+  lilv_plugin_free_port_caches(plugin);
+  lilv_port_hash_free(plugin->port_index);
+  plugin->port_index = NULL;
+
+  for (size_t i = 0U; i < plugin->n_designations; ++i) {
+    lilv_node_free(plugin->designations[i].designation);
+  }
+
+  free(plugin->designations);
+  plugin->designations   = NULL;
+  plugin->n_designations = 0U;
+  plugin->latency_port   = UINT32_MAX;
+
   if (plugin->ports) {
     for (uint32_t i = 0; i < plugin->num_ports; ++i) {
       lilv_port_free(plugin, plugin->ports[i]);
@@ -100,6 +147,12 @@ lilv_plugin_free(LilvPlugin* plugin)
   lilv_nodes_free(plugin->data_uris);
   plugin->data_uris = NULL;
 
+  free(plugin->class_set);
+  plugin->class_set = NULL;
+
+  lilv_feature_bits_clear(&plugin->required);
+  lilv_feature_bits_clear(&plugin->optional);
+
   free(plugin);
 }
 
@@ -168,6 +221,7 @@ load_prototypes(LilvPlugin* const plugin)
   }
   sord_iter_free(iter);
   sord_free(skel);
+  ++plugin->world->generation;
 }
 
 static void
@@ -220,6 +274,7 @@ lilv_plugin_load(LilvPlugin* plugin)
                                    lilv_world_blank_node_prefix(plugin->world));
       serd_reader_read_file_handle(
         reader, fd, (const uint8_t*)"(dyn-manifest)");
+      ++plugin->world->generation;
       fclose(fd);
     }
   }
@@ -242,6 +297,226 @@ is_symbol(const char* str)
   return true;
 }
 
+/// A port description collected from a single sweep over its statements
+typedef struct {
+  const SordNode* node;        ///< Port node
+  const SordNode* symbol;      ///< Unique lv2:symbol, or null
+  const SordNode* index;       ///< Unique lv2:index, or null
+  const SordNode* def;         ///< First lv2:default, or null
+  const SordNode* min;         ///< First lv2:minimum, or null
+  const SordNode* max;         ///< First lv2:maximum, or null
+  uint32_t        properties;  ///< Well-known properties (LilvPortProperty)
+  size_t          first_type;  ///< Index of first rdf:type in the type array
+  size_t          n_types;     ///< Number of rdf:type values
+  size_t          first_des;   ///< Index of first lv2:designation in array
+  size_t          n_des;       ///< Number of lv2:designation values
+  uint32_t        index_value; ///< Numeric value of index
+} PortDescription;
+
+/// A dynamic array of nodes
+typedef struct {
+  const SordNode** nodes;
+  size_t           n_nodes;
+  size_t           capacity;
+} NodeArray;
+
+/// Types and designations of all ports, referred to by port descriptions
+typedef struct {
+  NodeArray types;
+  NodeArray designations;
+} PortNodes;
+
+static void
+node_array_append(NodeArray* const array, const SordNode* const node)
+{
+  if (array->n_nodes == array->capacity) {
+    array->capacity = array->capacity ? (array->capacity * 2U) : 16U;
+    array->nodes    = (const SordNode**)realloc(
+      array->nodes, array->capacity * sizeof(const SordNode*));
+  }
+
+  array->nodes[array->n_nodes++] = node;
+}
+
+/// Set `*field` to `value` if this is the first, or null if it's a duplicate
+static void
+set_unique(const SordNode** const field,
+           unsigned* const        count,
+           const SordNode* const  value)
+{
+  *field = (*count)++ ? NULL : value;
+}
+
+static void
+set_first(const SordNode** const field, const SordNode* const value)
+{
+  if (!*field) {
+    *field = value;
+  }
+}
+
+/// Describe a port by sweeping over all of its statements once
+static void
+lilv_plugin_describe_port(const LilvPlugin* const plugin,
+                          const SordNode* const   port,
+                          PortDescription* const  desc,
+                          PortNodes* const        nodes)
+{
+  LilvWorld* const      world     = plugin->world;
+  const LilvURIs* const uris      = &world->uris;
+  unsigned              n_symbols = 0U;
+  unsigned              n_indices = 0U;
+
+  memset(desc, 0, sizeof(PortDescription));
+  desc->node       = port;
+  desc->first_type = nodes->types.n_nodes;
+  desc->first_des  = nodes->designations.n_nodes;
+
+  SordIter* const s = sord_search(world->model, port, NULL, NULL, NULL);
+  FOREACH_MATCH (s) {
+    const SordNode* const pred = sord_iter_get_node(s, SORD_PREDICATE);
+    const SordNode* const obj  = sord_iter_get_node(s, SORD_OBJECT);
+
+    if (pred == uris->rdf_type) {
+      if (sord_node_get_type(obj) == SORD_URI) {
+        node_array_append(&nodes->types, obj);
+        ++desc->n_types;
+      } else {
+        LILV_WARNF("Plugin <%s> port type is not a URI\n",
+                   lilv_node_as_uri(plugin->plugin_uri));
+      }
+    } else if (pred == uris->lv2_symbol) {
+      set_unique(&desc->symbol, &n_symbols, obj);
+    } else if (pred == uris->lv2_index) {
+      set_unique(&desc->index, &n_indices, obj);
+    } else if (pred == uris->lv2_portProperty) {
+      desc->properties |= lilv_port_property_flag(world, obj);
+    } else if (pred == uris->lv2_designation) {
+      node_array_append(&nodes->designations, obj);
+      ++desc->n_des;
+    } else if (pred == uris->lv2_default) {
+      set_first(&desc->def, obj);
+    } else if (pred == uris->lv2_minimum) {
+      set_first(&desc->min, obj);
+    } else if (pred == uris->lv2_maximum) {
+      set_first(&desc->max, obj);
+    }
+  }
+  sord_iter_free(s);
+}
+
+/// Return whether a port description has a valid symbol and index
+static bool
+lilv_plugin_check_port(const LilvPlugin* const plugin,
+                       PortDescription* const  desc)
+{
+  const SordNode* const symbol = desc->symbol;
+  const char* const     symbol_str =
+    symbol ? (const char*)sord_node_get_string(symbol) : "";
+
+  if (!symbol || sord_node_get_type(symbol) != SORD_LITERAL ||
+      !is_symbol(symbol_str)) {
+    LILV_ERRORF("Plugin <%s> port symbol \"%s\" is invalid\n",
+                lilv_node_as_uri(plugin->plugin_uri),
+                symbol_str);
+    return false;
+  }
+
+  const SordNode* const index = desc->index;
+  if (!index || sord_node_get_type(index) != SORD_LITERAL ||
+      !sord_node_equals(sord_node_get_datatype(index),
+                        plugin->world->uris.xsd_integer)) {
+    LILV_ERRORF("Plugin <%s> port index is not an integer\n",
+                lilv_node_as_uri(plugin->plugin_uri));
+    return false;
+  }
+
+  const char* const index_str = (const char*)sord_node_get_string(index);
+  desc->index_value           = (uint32_t)strtol(index_str, NULL, 10);
+  return true;
+}
+
+/// Return the value of a numeric literal as a float, or NAN
+static float
+lilv_plugin_node_float(const LilvPlugin* const plugin,
+                       const SordNode* const   node)
+{
+  LilvNode* const value = lilv_node_new_from_node(plugin->world, node);
+  const float     f     = lilv_node_as_float(value);
+
+  lilv_node_free(value);
+  return f;
+}
+
+/// Build the array of port designations, in port index order
+static void
+lilv_plugin_load_designations(LilvPlugin* const            plugin,
+                              const PortDescription* const descs,
+                              const size_t                 n_descs,
+                              const NodeArray* const       designations)
+{
+  const size_t n_des = designations->n_nodes;
+  if (!n_des) {
+    return;
+  }
+
+  // Count the designations of each port to find where those of each start
+  size_t* const offsets =
+    (size_t*)calloc(plugin->num_ports + 1U, sizeof(size_t));
+  for (size_t i = 0U; i < n_descs; ++i) {
+    offsets[descs[i].index_value + 1U] += descs[i].n_des;
+  }
+
+  for (uint32_t i = 1U; i <= plugin->num_ports; ++i) {
+    offsets[i] += offsets[i - 1U];
+  }
+
+  // Place every designation after the previous ones of the same port
+  plugin->designations =
+    (PortDesignation*)calloc(n_des, sizeof(PortDesignation));
+  plugin->n_designations = n_des;
+
+  for (size_t i = 0U; i < n_descs; ++i) {
+    const PortDescription* const desc = &descs[i];
+    LilvPort* const              port = plugin->ports[desc->index_value];
+
+    for (size_t d = 0U; d < desc->n_des; ++d) {
+      const SordNode* const node = designations->nodes[desc->first_des + d];
+      PortDesignation* const entry =
+        &plugin->designations[offsets[desc->index_value]++];
+
+      entry->designation = lilv_node_new_from_node(plugin->world, node);
+      entry->port        = port;
+      if (!port->designation) {
+        port->designation = entry->designation;
+      }
+    }
+  }
+
+  free(offsets);
+}
+
+/// Find the first port that reports latency, or return UINT32_MAX
+static uint32_t
+lilv_plugin_find_latency_port(const LilvPlugin* const plugin)
+{
+  for (uint32_t i = 0U; i < plugin->num_ports; ++i) {
+    if (plugin->ports[i]->properties & LILV_PORT_REPORTS_LATENCY) {
+      return i;
+    }
+  }
+
+  for (size_t i = 0U; i < plugin->n_designations; ++i) {
+    const PortDesignation* const entry = &plugin->designations[i];
+    if (entry->designation->node == plugin->world->uris.lv2_latency &&
+        (entry->port->class_flags & LILV_PORT_CLASS_OUTPUT)) {
+      return entry->port->index;
+    }
+  }
+
+  return UINT32_MAX;
+}
+
 static void
 lilv_plugin_load_ports_if_necessary(const LilvPlugin* const_plugin)
 {
@@ -249,94 +524,105 @@ lilv_plugin_load_ports_if_necessary(const LilvPlugin* const_plugin)
 
   lilv_plugin_load_if_necessary(plugin);
 
-  if (!plugin->ports) {
-    plugin->ports    = (LilvPort**)malloc(sizeof(LilvPort*));
-    plugin->ports[0] = NULL;
+  if (plugin->ports) {
+    return;
+  }
 
-    SordIter* ports = sord_search(plugin->world->model,
-                                  plugin->plugin_uri->node,
-                                  plugin->world->uris.lv2_port,
-                                  NULL,
-                                  NULL);
+  // Describe every port, sweeping the statements of each only once
+  PortDescription* descs     = NULL;
+  size_t           n_descs   = 0U;
+  size_t           max_descs = 0U;
+  PortNodes        nodes     = {{NULL, 0U, 0U}, {NULL, 0U, 0U}};
+  uint32_t         n_ports   = 0U;
+  bool             valid     = true;
 
-    FOREACH_MATCH (ports) {
-      const SordNode* port = sord_iter_get_node(ports, SORD_OBJECT);
+  SordIter* ports = sord_search(plugin->world->model,
+                                plugin->plugin_uri->node,
+                                plugin->world->uris.lv2_port,
+                                NULL,
+                                NULL);
 
-      const SordNode* symbol = lilv_plugin_get_unique_internal(
-        plugin, port, plugin->world->uris.lv2_symbol);
+  FOREACH_MATCH (ports) {
+    if (n_descs == max_descs) {
+      max_descs = max_descs ? (max_descs * 2U) : 16U;
+      descs     = (PortDescription*)realloc(
+        descs, max_descs * sizeof(PortDescription));
+    }
 
-      const char* const symbol_str =
-        symbol ? (const char*)sord_node_get_string(symbol) : "";
+    PortDescription* const desc = &descs[n_descs++];
+    const SordNode* const  port = sord_iter_get_node(ports, SORD_OBJECT);
 
-      if (!symbol || sord_node_get_type(symbol) != SORD_LITERAL ||
-          !is_symbol(symbol_str)) {
-        LILV_ERRORF("Plugin <%s> port symbol \"%s\" is invalid\n",
-                    lilv_node_as_uri(plugin->plugin_uri),
-                    symbol_str);
-        lilv_plugin_free_ports(plugin);
-        break;
-      }
+    lilv_plugin_describe_port(plugin, port, desc, &nodes);
+    valid = lilv_plugin_check_port(plugin, desc);
+    if (!valid) {
+      break;
+    }
 
-      const SordNode* index = lilv_plugin_get_unique_internal(
-        plugin, port, plugin->world->uris.lv2_index);
+    if (desc->index_value >= n_ports) {
+      n_ports = desc->index_value + 1U;
+    }
+  }
+  sord_iter_free(ports);
 
-      if (!index || sord_node_get_type(index) != SORD_LITERAL ||
-          !sord_node_equals(sord_node_get_datatype(index),
-                            plugin->world->uris.xsd_integer)) {
-        LILV_ERRORF("Plugin <%s> port index is not an integer\n",
-                    lilv_node_as_uri(plugin->plugin_uri));
-        lilv_plugin_free_ports(plugin);
-        break;
-      }
+  // Allocate the port array and create every port
+  if (valid) {
+    plugin->ports     = (LilvPort**)calloc(n_ports + 1U, sizeof(LilvPort*));
+    plugin->num_ports = n_ports;
 
-      const char* const index_str  = (const char*)sord_node_get_string(index);
-      const uint32_t    this_index = (uint32_t)strtol(index_str, NULL, 10);
-      LilvPort*         this_port  = NULL;
-      if (plugin->num_ports > this_index) {
-        this_port = plugin->ports[this_index];
-      } else {
-        plugin->ports = (LilvPort**)realloc(
-          plugin->ports, (this_index + 1) * sizeof(LilvPort*));
-        memset(plugin->ports + plugin->num_ports,
-               '\0',
-               (this_index - plugin->num_ports) * sizeof(LilvPort*));
-        plugin->num_ports = this_index + 1;
-      }
+    for (size_t i = 0U; i < n_descs; ++i) {
+      const PortDescription* const desc  = &descs[i];
+      const uint32_t               index = desc->index_value;
+      LilvPort*                    port  = plugin->ports[index];
 
       // Haven't seen this port yet, add it to array
-      if (!this_port) {
-        this_port = lilv_port_new(plugin->world, port, this_index, symbol_str);
-        plugin->ports[this_index] = this_port;
+      if (!port) {
+        port = lilv_port_new(plugin->world,
+                             desc->node,
+                             index,
+                             (const char*)sord_node_get_string(desc->symbol));
+
+        port->properties = desc->properties;
+        port->def        = lilv_plugin_node_float(plugin, desc->def);
+        port->min        = lilv_plugin_node_float(plugin, desc->min);
+        port->max        = lilv_plugin_node_float(plugin, desc->max);
+
+        plugin->ports[index] = port;
       }
 
-      SordIter* types = sord_search(
-        plugin->world->model, port, plugin->world->uris.rdf_type, NULL, NULL);
-      FOREACH_MATCH (types) {
-        const SordNode* type = sord_iter_get_node(types, SORD_OBJECT);
-        if (sord_node_get_type(type) == SORD_URI) {
-          zix_tree_insert((ZixTree*)this_port->classes,
-                          lilv_node_new_from_node(plugin->world, type),
-                          NULL);
-        } else {
-          LILV_WARNF("Plugin <%s> port type is not a URI\n",
-                     lilv_node_as_uri(plugin->plugin_uri));
-        }
+      for (size_t t = 0U; t < desc->n_types; ++t) {
+        lilv_port_add_class(
+          plugin->world, port, nodes.types.nodes[desc->first_type + t]);
       }
-      sord_iter_free(types);
     }
-    sord_iter_free(ports);
 
-    // Check sanity
-    for (uint32_t i = 0; i < plugin->num_ports; ++i) {
-      if (!plugin->ports[i]) {
-        LILV_ERRORF("Plugin <%s> is missing port %u/%u\n",
-                    lilv_node_as_uri(plugin->plugin_uri),
-                    i,
-                    plugin->num_ports);
-        lilv_plugin_free_ports(plugin);
-        break;
-      }
+    lilv_plugin_load_designations(
+      plugin, descs, n_descs, &nodes.designations);
+  }
+
+  free(nodes.designations.nodes);
+  free(nodes.types.nodes);
+  free(descs);
+
+  // Check sanity
+  for (uint32_t i = 0; i < plugin->num_ports; ++i) {
+    if (!plugin->ports[i]) {
+      LILV_ERRORF("Plugin <%s> is missing port %u/%u\n",
+                  lilv_node_as_uri(plugin->plugin_uri),
+                  i,
+                  plugin->num_ports);
+      lilv_plugin_free_ports(plugin);
+      break;
+    }
+  }
+
+  // Index ports by symbol, where the first of any duplicates wins
+  if (plugin->ports) {
+    plugin->port_index = lilv_port_hash_new();
+    for (uint32_t i = 0; plugin->port_index && i < plugin->num_ports; ++i) {
+      lilv_port_hash_insert(plugin->port_index, plugin->ports[i]);
     }
+
+    plugin->latency_port = lilv_plugin_find_latency_port(plugin);
   }
 }
 
@@ -345,7 +631,15 @@ lilv_plugin_load_if_necessary(const LilvPlugin* plugin)
 {
   assert(plugin);
   if (!plugin->loaded) {
+    LilvWorld* const world = plugin->world;
+    const uint64_t   start = world->opt.stats ? lilv_time_ns() : 0U;
+
     lilv_plugin_load((LilvPlugin*)plugin);
+
+    if (world->opt.stats) {
+      ++world->stats.n_plugin_loads;
+      world->stats.plugin_load_time += lilv_time_ns() - start;
+    }
   }
 }
 
@@ -400,6 +694,8 @@ lilv_plugin_get_class(const LilvPlugin* plugin)
 {
   lilv_plugin_load_if_necessary((LilvPlugin*)plugin);
   if (!plugin->plugin_class) {
+    lilv_world_update_plugin_classes(plugin->world);
+
     // <plugin> a ?class
     SordIter* c = sord_search(plugin->world->model,
                               plugin->plugin_uri->node,
@@ -408,23 +704,18 @@ lilv_plugin_get_class(const LilvPlugin* plugin)
                               NULL);
     FOREACH_MATCH (c) {
       const SordNode* class_node = sord_iter_get_node(c, SORD_OBJECT);
-      if (sord_node_get_type(class_node) != SORD_URI) {
+      if (sord_node_get_type(class_node) != SORD_URI ||
+          sord_node_equals(class_node, plugin->world->uris.lv2_Plugin)) {
         continue;
       }
 
-      LilvNode* klass = lilv_node_new_from_node(plugin->world, class_node);
-      if (!lilv_node_equals(klass, plugin->world->lv2_plugin_class->uri)) {
-        const LilvPluginClass* pclass =
-          lilv_plugin_classes_get_by_uri(plugin->world->plugin_classes, klass);
+      const LilvPluginClass* pclass =
+        lilv_world_find_plugin_class(plugin->world, class_node);
 
-        if (pclass) {
-          ((LilvPlugin*)plugin)->plugin_class = pclass;
-          lilv_node_free(klass);
-          break;
-        }
+      if (pclass) {
+        ((LilvPlugin*)plugin)->plugin_class = pclass;
+        break;
       }
-
-      lilv_node_free(klass);
     }
     sord_iter_free(c);
 
@@ -435,6 +726,68 @@ lilv_plugin_get_class(const LilvPlugin* plugin)
   return plugin->plugin_class;
 }
 
+uint64_t*
+lilv_plugin_new_class_set(const LilvPlugin* const plugin)
+{
+  const LilvWorld* const  world = plugin->world;
+  const ClassIndex* const index = &world->class_index;
+  uint64_t* const         classes =
+    (uint64_t*)calloc(index->n_words + 1U, sizeof(uint64_t));
+  if (!classes) {
+    return NULL;
+  }
+
+  // <plugin> a ?class
+  SordIter* c = sord_search(
+    world->model, plugin->plugin_uri->node, world->uris.rdf_type, NULL, NULL);
+  FOREACH_MATCH (c) {
+    const LilvPluginClass* const pclass =
+      lilv_world_find_plugin_class(world, sord_iter_get_node(c, SORD_OBJECT));
+
+    if (pclass) {
+      const uint64_t* const ancestors =
+        index->ancestors + ((size_t)pclass->id * index->n_words);
+
+      for (uint32_t w = 0U; w < index->n_words; ++w) {
+        classes[w] |= ancestors[w];
+      }
+    }
+  }
+  sord_iter_free(c);
+
+  return classes;
+}
+
+bool
+lilv_plugin_is_a(const LilvPlugin* plugin, const LilvPluginClass* plugin_class)
+{
+  lilv_plugin_load_if_necessary((LilvPlugin*)plugin);
+  lilv_world_update_plugin_classes(plugin->world);
+
+  // Every plugin is an lv2:Plugin, even without an explicit type
+  const LilvWorld* const world = plugin->world;
+  if (lilv_node_equals(plugin_class->uri, world->lv2_plugin_class->uri)) {
+    return true;
+  }
+
+  const ClassIndex* const index = &world->class_index;
+  if (plugin_class->id >= index->n_classes) {
+    return false;
+  }
+
+  if (!plugin->class_set || plugin->class_epoch != index->epoch) {
+    free(plugin->class_set);
+    ((LilvPlugin*)plugin)->class_set   = lilv_plugin_new_class_set(plugin);
+    ((LilvPlugin*)plugin)->class_epoch = index->epoch;
+    if (!plugin->class_set) {
+      return false;
+    }
+  }
+
+  const uint32_t id = plugin_class->id;
+  return plugin->class_set[id / 64U] & (1ULL << (id % 64U));
+}
+
 static LilvNodes*
 lilv_plugin_get_value_internal(const LilvPlugin* plugin,
                                const SordNode*   predicate)
@@ -478,27 +831,54 @@ lilv_plugin_verify(const LilvPlugin* plugin)
   return true;
 }
 
-LilvNode*
-lilv_plugin_get_name(const LilvPlugin* plugin)
+/// Return the doap:name object that the name of a plugin is taken from
+static const SordNode*
+lilv_plugin_find_name(const LilvPlugin* const plugin)
 {
-  LilvNodes* results =
-    lilv_plugin_get_value_internal(plugin, plugin->world->uris.doap_name);
+  lilv_plugin_load_if_necessary(plugin);
 
-  LilvNode* ret = NULL;
-  if (results) {
-    const LilvNode* val = lilv_nodes_get_first(results);
-    if (lilv_node_is_string(val)) {
-      ret = lilv_node_duplicate(val);
-    }
-    lilv_nodes_free(results);
-  }
+  LilvWorld* const world = plugin->world;
+  return lilv_first_match(
+    world, plugin->plugin_uri->node, world->uris.doap_name);
+}
 
-  if (!ret) {
+/// Return `name` if it's a string, otherwise warn and return null
+static const LilvNode*
+lilv_plugin_check_name(const LilvPlugin* const plugin,
+                       const LilvNode* const   name)
+{
+  if (!lilv_node_is_string(name)) {
     LILV_WARNF("Plugin <%s> has no (mandatory) doap:name\n",
                lilv_node_as_string(lilv_plugin_get_uri(plugin)));
+    return NULL;
   }
 
-  return ret;
+  return name;
+}
+
+LilvNode*
+lilv_plugin_get_name(const LilvPlugin* plugin)
+{
+  LilvNode* const name =
+    lilv_node_new_from_node(plugin->world, lilv_plugin_find_name(plugin));
+
+  if (!lilv_plugin_check_name(plugin, name)) {
+    lilv_node_free(name);
+    return NULL;
+  }
+
+  return name;
+}
+
+const LilvNode*
+lilv_plugin_get_shared_name(const LilvPlugin* const plugin)
+{
+  LilvWorld* const world = plugin->world;
+
+  return lilv_plugin_check_name(
+    plugin,
+    lilv_node_pool_intern(
+      world->shared_nodes, world, lilv_plugin_find_name(plugin)));
 }
 
 LilvNodes*
@@ -509,6 +889,28 @@ lilv_plugin_get_value(const LilvPlugin* plugin, const LilvNode* predicate)
     plugin->world, plugin->plugin_uri, predicate, NULL);
 }
 
+unsigned
+lilv_plugin_foreach_value(const LilvPlugin* const plugin,
+                          const LilvNode* const   predicate,
+                          const LilvNodeFunc      func,
+                          void* const             user_data)
+{
+  lilv_plugin_load_if_necessary(plugin);
+  return lilv_world_foreach_match(
+    plugin->world, plugin->plugin_uri, predicate, NULL, func, user_data);
+}
+
+unsigned
+lilv_plugin_get_values(const LilvPlugin* const      plugin,
+                       const unsigned               n_predicates,
+                       const LilvNode* const* const predicates,
+                       LilvNode** const             values)
+{
+  lilv_plugin_load_if_necessary(plugin);
+  return lilv_world_get_values(
+    plugin->world, plugin->plugin_uri, n_predicates, predicates, values);
+}
+
 uint32_t
 lilv_plugin_get_num_ports(const LilvPlugin* plugin)
 {
@@ -516,51 +918,147 @@ lilv_plugin_get_num_ports(const LilvPlugin* plugin)
   return plugin->num_ports;
 }
 
+/// Return the port ranges as an array of minimums, maximums, then defaults
+static const float*
+lilv_plugin_get_ranges(const LilvPlugin* const plugin)
+{
+  lilv_plugin_load_ports_if_necessary(plugin);
+  if (!plugin->port_ranges && plugin->num_ports) {
+    const uint32_t n_ports = plugin->num_ports;
+    float* const   ranges  = (float*)malloc(3U * n_ports * sizeof(float));
+
+    for (uint32_t i = 0; ranges && i < n_ports; ++i) {
+      const LilvPort* const port = plugin->ports[i];
+
+      ranges[i]                  = port->min;
+      ranges[n_ports + i]        = port->max;
+      ranges[(2U * n_ports) + i] = port->def;
+    }
+
+    ((LilvPlugin*)plugin)->port_ranges = ranges;
+  }
+
+  return plugin->port_ranges;
+}
+
 void
 lilv_plugin_get_port_ranges_float(const LilvPlugin* plugin,
                                   float*            min_values,
                                   float*            max_values,
                                   float*            def_values)
 {
-  lilv_plugin_load_ports_if_necessary(plugin);
-  LilvNode*  min    = NULL;
-  LilvNode*  max    = NULL;
-  LilvNode*  def    = NULL;
-  LilvNode** minptr = min_values ? &min : NULL;
-  LilvNode** maxptr = max_values ? &max : NULL;
-  LilvNode** defptr = def_values ? &def : NULL;
+  const float* const ranges = lilv_plugin_get_ranges(plugin);
+  const uint32_t     n      = plugin->num_ports;
+  if (!ranges) {
+    return;
+  }
 
-  for (uint32_t i = 0; i < plugin->num_ports; ++i) {
-    lilv_port_get_range(plugin, plugin->ports[i], defptr, minptr, maxptr);
+  if (min_values) {
+    memcpy(min_values, ranges, n * sizeof(float));
+  }
 
-    if (min_values) {
-      if (lilv_node_is_float(min) || lilv_node_is_int(min)) {
-        min_values[i] = lilv_node_as_float(min);
-      } else {
-        min_values[i] = NAN;
-      }
-    }
+  if (max_values) {
+    memcpy(max_values, ranges + n, n * sizeof(float));
+  }
 
-    if (max_values) {
-      if (lilv_node_is_float(max) || lilv_node_is_int(max)) {
-        max_values[i] = lilv_node_as_float(max);
-      } else {
-        max_values[i] = NAN;
-      }
-    }
+  if (def_values) {
+    memcpy(def_values, ranges + (2U * n), n * sizeof(float));
+  }
+}
 
-    if (def_values) {
-      if (lilv_node_is_float(def) || lilv_node_is_int(def)) {
-        def_values[i] = lilv_node_as_float(def);
-      } else {
-        def_values[i] = NAN;
-      }
+void
+lilv_plugin_get_port_range_arrays(const LilvPlugin* plugin,
+                                  const float**     min_values,
+                                  const float**     max_values,
+                                  const float**     def_values)
+{
+  const float* const ranges = lilv_plugin_get_ranges(plugin);
+  const uint32_t     n      = plugin->num_ports;
+
+  if (min_values) {
+    *min_values = ranges;
+  }
+
+  if (max_values) {
+    *max_values = ranges ? (ranges + n) : NULL;
+  }
+
+  if (def_values) {
+    *def_values = ranges ? (ranges + (2U * n)) : NULL;
+  }
+}
+
+/// Return the first value of a port property as a new node, or null
+static LilvNode*
+lilv_plugin_get_port_value(const LilvPlugin* const plugin,
+                           const LilvPort* const   port,
+                           const SordNode* const   predicate)
+{
+  LilvWorld* const world = plugin->world;
+  SordNode* const  node =
+    sord_get(world->model, port->node->node, predicate, NULL, NULL);
+
+  LilvNode* const value = lilv_node_new_from_node(world, node);
+  sord_node_free(world->world, node);
+  return value;
+}
+
+static void
+lilv_plugin_get_port_info(const LilvPlugin* const plugin,
+                          const LilvPort* const   port,
+                          LilvPortInfo* const     info)
+{
+  const LilvURIs* const uris = &plugin->world->uris;
+
+  info->index     = port->index;
+  info->symbol    = lilv_node_as_string(port->symbol);
+  info->direction = LILV_PORT_DIRECTION_UNKNOWN;
+  info->data_type = LILV_PORT_DATA_UNKNOWN;
+
+  const uint32_t classes = port->class_flags;
+  if (classes & LILV_PORT_CLASS_INPUT) {
+    info->direction = LILV_PORT_DIRECTION_INPUT;
+  } else if (classes & LILV_PORT_CLASS_OUTPUT) {
+    info->direction = LILV_PORT_DIRECTION_OUTPUT;
+  }
+
+  if (classes & LILV_PORT_CLASS_AUDIO) {
+    info->data_type = LILV_PORT_DATA_AUDIO;
+  } else if (classes & LILV_PORT_CLASS_CONTROL) {
+    info->data_type = LILV_PORT_DATA_CONTROL;
+  } else if (classes & LILV_PORT_CLASS_CV) {
+    info->data_type = LILV_PORT_DATA_CV;
+  } else if (classes & LILV_PORT_CLASS_ATOM) {
+    info->data_type = LILV_PORT_DATA_ATOM;
+  } else if (classes & LILV_PORT_CLASS_EVENT) {
+    info->data_type = LILV_PORT_DATA_EVENT;
+  }
+
+  info->def         = port->def;
+  info->min         = port->min;
+  info->max         = port->max;
+  info->properties  = port->properties;
+  info->designation = port->designation;
+  info->buffer_type =
+    lilv_plugin_get_port_value(plugin, port, uris->atom_bufferType);
+}
+
+const LilvPortInfo*
+lilv_plugin_get_port_table(const LilvPlugin* const plugin)
+{
+  lilv_plugin_load_ports_if_necessary(plugin);
+  if (!plugin->port_table && plugin->num_ports) {
+    LilvPortInfo* const table =
+      (LilvPortInfo*)calloc(plugin->num_ports, sizeof(LilvPortInfo));
+
+    for (uint32_t i = 0; table && i < plugin->num_ports; ++i) {
+      lilv_plugin_get_port_info(plugin, plugin->ports[i], &table[i]);
     }
 
-    lilv_node_free(def);
-    lilv_node_free(min);
-    lilv_node_free(max);
+    ((LilvPlugin*)plugin)->port_table = table;
   }
+
+  return plugin->port_table;
 }
 
 uint32_t
@@ -572,21 +1070,33 @@ lilv_plugin_get_num_ports_of_class_va(
 {
   lilv_plugin_load_ports_if_necessary(plugin);
 
-  uint32_t count = 0;
-
-  // Build array of classes from args so we can walk it several times
+  // Collect well-known classes into a mask and any others into an array
+  LilvWorld* const world     = plugin->world;
+  uint32_t         mask      = lilv_port_class_flag(world, class_1->node);
   size_t           n_classes = 0;
   const LilvNode** classes   = NULL;
+  if (!mask) {
+    classes    = (const LilvNode**)malloc(sizeof(LilvNode*));
+    classes[0] = class_1;
+    n_classes  = 1;
+  }
+
   for (LilvNode* c = NULL; (c = va_arg(args, LilvNode*));) {
-    classes =
-      (const LilvNode**)realloc(classes, ++n_classes * sizeof(LilvNode*));
-    classes[n_classes - 1] = c;
+    const uint32_t flag = lilv_port_class_flag(world, c->node);
+    if (flag) {
+      mask |= flag;
+    } else {
+      classes =
+        (const LilvNode**)realloc(classes, ++n_classes * sizeof(LilvNode*));
+      classes[n_classes - 1] = c;
+    }
   }
 
-  // Check each port against every type
+  // Check each port against every class
+  uint32_t count = 0;
   for (unsigned i = 0; i < plugin->num_ports; ++i) {
     const LilvPort* port = plugin->ports[i];
-    if (port && lilv_port_is_a(plugin, port, class_1)) {
+    if (port && (port->class_flags & mask) == mask) {
       bool matches = true;
       for (size_t j = 0; j < n_classes; ++j) {
         if (!lilv_port_is_a(plugin, port, classes[j])) {
@@ -621,65 +1131,20 @@ lilv_plugin_get_num_ports_of_class(const LilvPlugin* plugin,
 
 bool
 lilv_plugin_has_latency(const LilvPlugin* plugin)
-{
-  lilv_plugin_load_if_necessary(plugin);
-  SordIter* ports = sord_search(plugin->world->model,
-                                plugin->plugin_uri->node,
-                                plugin->world->uris.lv2_port,
-                                NULL,
-                                NULL);
-
-  bool ret = false;
-  FOREACH_MATCH (ports) {
-    const SordNode* port = sord_iter_get_node(ports, SORD_OBJECT);
-
-    SordIter* prop = sord_search(plugin->world->model,
-                                 port,
-                                 plugin->world->uris.lv2_portProperty,
-                                 plugin->world->uris.lv2_reportsLatency,
-                                 NULL);
-
-    SordIter* des = sord_search(plugin->world->model,
-                                port,
-                                plugin->world->uris.lv2_designation,
-                                plugin->world->uris.lv2_latency,
-                                NULL);
-
-    const bool latent = !sord_iter_end(prop) || !sord_iter_end(des);
-    sord_iter_free(prop);
-    sord_iter_free(des);
-    if (latent) {
-      ret = true;
-      break;
-    }
-  }
-  sord_iter_free(ports);
-
-  return ret;
-}
-
-static const LilvPort*
-lilv_plugin_get_port_by_property(const LilvPlugin* plugin,
-                                 const SordNode*   port_property)
 {
   lilv_plugin_load_ports_if_necessary(plugin);
-  for (uint32_t i = 0; i < plugin->num_ports; ++i) {
-    LilvPort* port = plugin->ports[i];
-    SordIter* iter = sord_search(plugin->world->model,
-                                 port->node->node,
-                                 plugin->world->uris.lv2_portProperty,
-                                 port_property,
-                                 NULL);
-
-    const bool found = !sord_iter_end(iter);
-    sord_iter_free(iter);
+  if (plugin->latency_port != UINT32_MAX) {
+    return true;
+  }
 
-    if (found) {
-      return port;
+  for (size_t i = 0U; i < plugin->n_designations; ++i) {
+    const LilvNode* const designation = plugin->designations[i].designation;
+    if (designation->node == plugin->world->uris.lv2_latency) {
+      return true;
     }
   }
 
-  return NULL;
+  return false;
 }
 
 const LilvPort*
@@ -687,23 +1152,12 @@ lilv_plugin_get_port_by_designation(const LilvPlugin* plugin,
                                     const LilvNode*   port_class,
                                     const LilvNode*   designation)
 {
-  LilvWorld* world = plugin->world;
   lilv_plugin_load_ports_if_necessary(plugin);
-  for (uint32_t i = 0; i < plugin->num_ports; ++i) {
-    LilvPort* port = plugin->ports[i];
-    SordIter* iter = sord_search(world->model,
-                                 port->node->node,
-                                 world->uris.lv2_designation,
-                                 designation->node,
-                                 NULL);
-
-    const bool found =
-      !sord_iter_end(iter) &&
-      (!port_class || lilv_port_is_a(plugin, port, port_class));
-    sord_iter_free(iter);
-
-    if (found) {
-      return port;
+  for (size_t i = 0U; i < plugin->n_designations; ++i) {
+    const PortDesignation* const entry = &plugin->designations[i];
+    if (lilv_node_equals(entry->designation, designation) &&
+        (!port_class || lilv_port_is_a(plugin, entry->port, port_class))) {
+      return entry->port;
     }
   }
 
@@ -713,46 +1167,70 @@ lilv_plugin_get_port_by_designation(const LilvPlugin* plugin,
 uint32_t
 lilv_plugin_get_latency_port_index(const LilvPlugin* plugin)
 {
-  LilvNode* lv2_OutputPort = lilv_new_uri(plugin->world, LV2_CORE__OutputPort);
-  LilvNode* lv2_latency    = lilv_new_uri(plugin->world, LV2_CORE__latency);
-
-  const LilvPort* prop_port = lilv_plugin_get_port_by_property(
-    plugin, plugin->world->uris.lv2_reportsLatency);
-  const LilvPort* des_port =
-    lilv_plugin_get_port_by_designation(plugin, lv2_OutputPort, lv2_latency);
+  lilv_plugin_load_ports_if_necessary(plugin);
+  return plugin->latency_port;
+}
 
-  lilv_node_free(lv2_latency);
-  lilv_node_free(lv2_OutputPort);
+/**
+   Load the IDs of all required and optional features of a plugin.
 
-  if (prop_port) {
-    return prop_port->index;
+   @return Zero on success, or non-zero if the features couldn't be recorded,
+   in which case the plugin should be considered unsupported.
+*/
+static int
+lilv_plugin_load_features(const LilvPlugin* const const_plugin)
+{
+  LilvPlugin* const plugin = (LilvPlugin*)const_plugin;
+  if (plugin->loaded_features) {
+    return 0;
   }
 
-  if (des_port) {
-    return des_port->index;
+  lilv_plugin_load_if_necessary(plugin);
+
+  LilvWorld* const      world   = plugin->world;
+  const SordNode* const preds[] = {world->uris.lv2_requiredFeature,
+                                   world->uris.lv2_optionalFeature};
+  FeatureBits* const    bits[]  = {&plugin->required, &plugin->optional};
+  const unsigned        n_preds = sizeof(preds) / sizeof(preds[0]);
+
+  int st = 0;
+  for (unsigned p = 0U; p < n_preds; ++p) {
+    SordIter* const i = sord_search(
+      world->model, plugin->plugin_uri->node, preds[p], NULL, NULL);
+    FOREACH_MATCH (i) {
+      const SordNode* const feature = sord_iter_get_node(i, SORD_OBJECT);
+      const uint32_t id = lilv_feature_hash_intern(world->features, feature);
+      if (id == UINT32_MAX || lilv_feature_bits_add(bits[p], id)) {
+        st = 1;
+      }
+    }
+    sord_iter_free(i);
   }
 
-  return (uint32_t)-1;
+  // Leave features unloaded on failure, so they're tried again next time
+  plugin->loaded_features = !st;
+  return st;
 }
 
 bool
 lilv_plugin_has_feature(const LilvPlugin* plugin, const LilvNode* feature)
 {
-  lilv_plugin_load_if_necessary(plugin);
-  const SordNode* predicates[] = {plugin->world->uris.lv2_requiredFeature,
-                                  plugin->world->uris.lv2_optionalFeature,
-                                  NULL};
-
-  for (const SordNode** pred = predicates; *pred; ++pred) {
-    if (sord_ask(plugin->world->model,
-                 plugin->plugin_uri->node,
-                 *pred,
-                 feature->node,
-                 NULL)) {
-      return true;
-    }
-  }
-  return false;
+  lilv_plugin_load_features(plugin);
+
+  const uint32_t id =
+    lilv_feature_hash_find(plugin->world->features, feature->node);
+
+  return id != UINT32_MAX && (lilv_feature_bits_has(&plugin->required, id) ||
+                              lilv_feature_bits_has(&plugin->optional, id));
+}
+
+bool
+lilv_plugin_is_supported(const LilvPlugin*     plugin,
+                         const LilvFeatureSet* features)
+{
+  return features->world == plugin->world &&
+         !lilv_plugin_load_features(plugin) &&
+         lilv_feature_bits_includes(&features->features, &plugin->required);
 }
 
 LilvNodes*
@@ -826,15 +1304,24 @@ lilv_plugin_get_port_by_index(const LilvPlugin* plugin, uint32_t index)
 const LilvPort*
 lilv_plugin_get_port_by_symbol(const LilvPlugin* plugin, const LilvNode* symbol)
 {
-  lilv_plugin_load_ports_if_necessary(plugin);
-  for (uint32_t i = 0; i < plugin->num_ports; ++i) {
-    LilvPort* port = plugin->ports[i];
-    if (lilv_node_equals(port->symbol, symbol)) {
-      return port;
-    }
+  if (!lilv_node_is_string(symbol)) {
+    return NULL;
   }
 
-  return NULL;
+  const LilvPort* const port =
+    lilv_plugin_get_port_by_symbol_string(plugin, lilv_node_as_string(symbol));
+
+  return (port && lilv_node_equals(port->symbol, symbol)) ? port : NULL;
+}
+
+const LilvPort*
+lilv_plugin_get_port_by_symbol_string(const LilvPlugin* plugin,
+                                      const char*       symbol)
+{
+  lilv_plugin_load_ports_if_necessary(plugin);
+
+  return plugin->port_index ? lilv_port_hash_find(plugin->port_index, symbol)
+                            : NULL;
 }
 
 LilvNode*
@@ -859,6 +1346,18 @@ lilv_plugin_get_project(const LilvPlugin* plugin)
   return lilv_node_new_from_node(plugin->world, project);
 }
 
+const LilvNode*
+lilv_plugin_get_shared_project(const LilvPlugin* const plugin)
+{
+  lilv_plugin_load_if_necessary(plugin);
+
+  LilvWorld* const world = plugin->world;
+  return lilv_node_pool_intern(
+    world->shared_nodes,
+    world,
+    lilv_first_match(world, plugin->plugin_uri->node, world->uris.lv2_project));
+}
+
 static const SordNode*
 lilv_plugin_get_author(const LilvPlugin* plugin)
 {
@@ -965,7 +1464,7 @@ lilv_plugin_get_uis(const LilvPlugin* plugin)
     }
 
     LilvUI* const lilv_ui = lilv_ui_new(plugin->world, ui, type, binary);
-    zix_tree_insert((ZixTree*)result, lilv_ui, NULL);
+    lilv_collection_insert(result, lilv_ui);
   }
   sord_iter_free(uis);
 
@@ -999,8 +1498,7 @@ lilv_plugin_get_related(const LilvPlugin* plugin, const LilvNode* type)
     const SordNode* node = sord_iter_get_node(i, SORD_SUBJECT);
     if (!type ||
         sord_ask(world->model, node, world->uris.rdf_type, type->node, NULL)) {
-      zix_tree_insert(
-        (ZixTree*)matches, lilv_node_new_from_node(world, node), NULL);
+      lilv_collection_insert(matches, lilv_node_new_from_node(world, node));
     }
   }
 
@@ -0,0 +1,57 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE LilvPlugin
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "plugin_hash.h"
+
+#include "lilv_internal.h"
+#include "node_hash.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stddef.h>
+
+ZIX_PURE_FUNC static const SordNode*
+plugin_uri(const LilvPlugin* const plugin)
+{
+  return plugin->plugin_uri->node;
+}
+
+PluginHash*
+lilv_plugin_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, plugin_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_plugin_hash_free(PluginHash* const hash)
+{
+  zix_hash_free(hash);
+}
+
+LilvPlugin*
+lilv_plugin_hash_find(const PluginHash* const hash, const SordNode* const uri)
+{
+  return zix_hash_find_record(hash, uri);
+}
+
+ZixStatus
+lilv_plugin_hash_insert(PluginHash* const hash, LilvPlugin* const plugin)
+{
+  return zix_hash_insert(hash, plugin);
+}
+
+ZixStatus
+lilv_plugin_hash_remove(PluginHash* const hash, const SordNode* const uri)
+{
+  LilvPlugin* removed = NULL;
+  return zix_hash_remove(hash, uri, &removed);
+}
@@ -0,0 +1,38 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_PLUGIN_HASH_H
+#define LILV_PLUGIN_HASH_H
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/status.h>
+
+/// A hash of plugins keyed by interned URI, which doesn't own the plugins
+typedef struct ZixHashImpl PluginHash;
+
+/// Return a new empty plugin hash
+PluginHash* ZIX_ALLOCATED
+lilv_plugin_hash_new(void);
+
+/// Free a plugin hash (but not the plugins in it)
+void
+lilv_plugin_hash_free(PluginHash* ZIX_NULLABLE hash);
+
+/// Return the plugin with the given URI, or null
+LilvPlugin* ZIX_NULLABLE
+lilv_plugin_hash_find(const PluginHash* ZIX_NONNULL hash,
+                      const SordNode* ZIX_NONNULL   uri);
+
+/// Add a plugin to the hash
+ZixStatus
+lilv_plugin_hash_insert(PluginHash* ZIX_NONNULL hash,
+                        LilvPlugin* ZIX_NONNULL plugin);
+
+/// Remove the plugin with the given URI from the hash
+ZixStatus
+lilv_plugin_hash_remove(PluginHash* ZIX_NONNULL     hash,
+                        const SordNode* ZIX_NONNULL uri);
+
+#endif // LILV_PLUGIN_HASH_H
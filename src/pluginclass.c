@@ -5,9 +5,9 @@
 
 #include <lilv/lilv.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 LilvPluginClass*
@@ -22,6 +22,7 @@ lilv_plugin_class_new(LilvWorld*      world,
   pc->label           = lilv_node_new(world, LILV_VALUE_STRING, label);
   pc->parent_uri =
     (parent_node ? lilv_node_new_from_node(world, parent_node) : NULL);
+  pc->id = UINT32_MAX;
   return pc;
 }
 
@@ -59,21 +60,36 @@ lilv_plugin_class_get_label(const LilvPluginClass* plugin_class)
 LilvPluginClasses*
 lilv_plugin_class_get_children(const LilvPluginClass* plugin_class)
 {
+  lilv_world_update_plugin_classes(plugin_class->world);
+
   // Returned list doesn't own categories
-  LilvPluginClasses* all = plugin_class->world->plugin_classes;
-  LilvPluginClasses* result =
-    zix_tree_new(NULL, false, lilv_header_compare_by_uri, NULL, NULL, NULL);
-
-  for (ZixTreeIter* i = zix_tree_begin((ZixTree*)all);
-       i != zix_tree_end((ZixTree*)all);
-       i = zix_tree_iter_next(i)) {
-    const LilvPluginClass* c      = (LilvPluginClass*)zix_tree_get(i);
-    const LilvNode*        parent = lilv_plugin_class_get_parent_uri(c);
-    if (parent &&
-        lilv_node_equals(lilv_plugin_class_get_uri(plugin_class), parent)) {
-      zix_tree_insert((ZixTree*)result, (LilvPluginClass*)c, NULL);
+  const ClassIndex* const  index  = &plugin_class->world->class_index;
+  LilvPluginClasses* const result = lilv_plugin_classes_new_view();
+
+  const uint32_t id = plugin_class->id;
+  if (id < index->n_classes) {
+    for (uint32_t i = index->first_child[id]; i < index->first_child[id + 1U];
+         ++i) {
+      lilv_collection_insert(result, index->children[i]);
     }
   }
 
   return result;
 }
+
+bool
+lilv_plugin_class_is_a(const LilvPluginClass* plugin_class,
+                       const LilvPluginClass* ancestor)
+{
+  lilv_world_update_plugin_classes(plugin_class->world);
+
+  const ClassIndex* const index = &plugin_class->world->class_index;
+  if (plugin_class->id < index->n_classes && ancestor->id < index->n_classes) {
+    const uint64_t* const ancestors =
+      index->ancestors + ((size_t)plugin_class->id * index->n_words);
+
+    return ancestors[ancestor->id / 64U] & (1ULL << (ancestor->id % 64U));
+  }
+
+  return lilv_node_equals(plugin_class->uri, ancestor->uri);
+}
@@ -7,12 +7,13 @@
 
 #include <lilv/lilv.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
 
 #include <assert.h>
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 LilvPort*
 lilv_port_new(LilvWorld*      world,
@@ -20,14 +21,31 @@ lilv_port_new(LilvWorld*      world,
               uint32_t        index,
               const char*     symbol)
 {
-  LilvPort* port = (LilvPort*)malloc(sizeof(LilvPort));
-  port->node     = lilv_node_new_from_node(world, node);
-  port->index    = index;
-  port->symbol   = lilv_node_new(world, LILV_VALUE_STRING, symbol);
-  port->classes  = lilv_nodes_new();
+  LilvPort* port     = (LilvPort*)malloc(sizeof(LilvPort));
+  port->node         = lilv_node_new_from_node(world, node);
+  port->index        = index;
+  port->symbol       = lilv_node_new(world, LILV_VALUE_STRING, symbol);
+  port->classes      = lilv_nodes_new();
+  port->class_flags  = 0U;
+  port->properties   = 0U;
+  port->def          = NAN;
+  port->min          = NAN;
+  port->max          = NAN;
+  port->designation  = NULL;
+  port->scale_points = NULL;
   return port;
 }
 
+static void
+lilv_port_free_scale_points(ScalePointIndex* const index)
+{
+  if (index) {
+    lilv_scale_points_free(index->points);
+    free(index->by_value);
+    free(index);
+  }
+}
+
 void
 lilv_port_free(const LilvPlugin* plugin, LilvPort* port)
 {
@@ -37,16 +55,85 @@ lilv_port_free(const LilvPlugin* plugin, LilvPort* port)
     lilv_node_free(port->node);
     lilv_nodes_free(port->classes);
     lilv_node_free(port->symbol);
+    lilv_port_free_scale_points(port->scale_points);
     free(port);
   }
 }
 
+uint32_t
+lilv_port_class_flag(const LilvWorld* const world,
+                     const SordNode* const  port_class)
+{
+  // Ordered to correspond with the bits in LilvPortClassFlag
+  const SordNode* const classes[] = {world->uris.lv2_InputPort,
+                                     world->uris.lv2_OutputPort,
+                                     world->uris.lv2_AudioPort,
+                                     world->uris.lv2_ControlPort,
+                                     world->uris.lv2_CVPort,
+                                     world->uris.atom_AtomPort,
+                                     world->uris.event_EventPort};
+
+  const uint32_t n_classes = sizeof(classes) / sizeof(classes[0]);
+  for (uint32_t i = 0U; i < n_classes; ++i) {
+    if (sord_node_equals(classes[i], port_class)) {
+      return 1U << i;
+    }
+  }
+
+  return 0U;
+}
+
+uint32_t
+lilv_port_property_flag(const LilvWorld* const world,
+                        const SordNode* const  property)
+{
+  // Ordered to correspond with the bits in LilvPortProperty
+  const SordNode* const properties[] = {world->uris.lv2_connectionOptional,
+                                        world->uris.lv2_enumeration,
+                                        world->uris.lv2_integer,
+                                        world->uris.lv2_isSideChain,
+                                        world->uris.lv2_reportsLatency,
+                                        world->uris.lv2_sampleRate,
+                                        world->uris.lv2_toggled,
+                                        world->uris.pprops_causesArtifacts,
+                                        world->uris.pprops_continuousCV,
+                                        world->uris.pprops_discreteCV,
+                                        world->uris.pprops_expensive,
+                                        world->uris.pprops_hasStrictBounds,
+                                        world->uris.pprops_logarithmic,
+                                        world->uris.pprops_notAutomatic,
+                                        world->uris.pprops_notOnGUI,
+                                        world->uris.pprops_trigger};
+
+  const uint32_t n_properties = sizeof(properties) / sizeof(properties[0]);
+  for (uint32_t i = 0U; i < n_properties; ++i) {
+    if (sord_node_equals(properties[i], property)) {
+      return 1U << i;
+    }
+  }
+
+  return 0U;
+}
+
+void
+lilv_port_add_class(LilvWorld* const      world,
+                    LilvPort* const       port,
+                    const SordNode* const type)
+{
+  lilv_collection_insert(port->classes, lilv_node_new_from_node(world, type));
+
+  port->class_flags |= lilv_port_class_flag(world, type);
+}
+
 bool
 lilv_port_is_a(const LilvPlugin* plugin,
                const LilvPort*   port,
                const LilvNode*   port_class)
 {
-  (void)plugin;
+  const uint32_t flag = lilv_port_class_flag(plugin->world, port_class->node);
+  if (flag) {
+    return port->class_flags & flag;
+  }
 
   LILV_FOREACH (nodes, i, port->classes) {
     if (lilv_node_equals(lilv_nodes_get(port->classes, i), port_class)) {
@@ -62,6 +149,11 @@ lilv_port_has_property(const LilvPlugin* plugin,
                        const LilvPort*   port,
                        const LilvNode*   property)
 {
+  const uint32_t flag = lilv_port_property_flag(plugin->world, property->node);
+  if (flag) {
+    return port->properties & flag;
+  }
+
   return sord_ask(plugin->world->model,
                   port->node->node,
                   plugin->world->uris.lv2_portProperty,
@@ -122,6 +214,23 @@ lilv_port_get_value(const LilvPlugin* plugin,
   return lilv_port_get_value_by_node(plugin, port, predicate->node);
 }
 
+unsigned
+lilv_port_foreach_value(const LilvPlugin* const plugin,
+                        const LilvPort* const   port,
+                        const LilvNode* const   predicate,
+                        const LilvNodeFunc      func,
+                        void* const             user_data)
+{
+  if (!lilv_node_is_uri(predicate)) {
+    LILV_ERRORF("Predicate \"%s\" is not a URI\n",
+                sord_node_get_string(predicate->node));
+    return 0U;
+  }
+
+  return lilv_visit_nodes(
+    plugin->world, port->node->node, predicate->node, NULL, func, user_data);
+}
+
 LilvNode*
 lilv_port_get(const LilvPlugin* plugin,
               const LilvPort*   port,
@@ -136,6 +245,35 @@ lilv_port_get(const LilvPlugin* plugin,
   return value;
 }
 
+const LilvNode*
+lilv_port_get_shared(const LilvPlugin* const plugin,
+                     const LilvPort* const   port,
+                     const LilvNode* const   predicate)
+{
+  if (!lilv_node_is_uri(predicate)) {
+    LILV_ERRORF("Predicate \"%s\" is not a URI\n",
+                sord_node_get_string(predicate->node));
+    return NULL;
+  }
+
+  LilvWorld* const world = plugin->world;
+  return lilv_node_pool_intern(
+    world->shared_nodes,
+    world,
+    lilv_first_match(world, port->node->node, predicate->node));
+}
+
+unsigned
+lilv_port_get_values(const LilvPlugin* const      plugin,
+                     const LilvPort* const        port,
+                     const unsigned               n_predicates,
+                     const LilvNode* const* const predicates,
+                     LilvNode** const             values)
+{
+  return lilv_world_get_values(
+    plugin->world, port->node, n_predicates, predicates, values);
+}
+
 uint32_t
 lilv_port_get_index(const LilvPlugin* plugin, const LilvPort* port)
 {
@@ -152,27 +290,51 @@ lilv_port_get_symbol(const LilvPlugin* plugin, const LilvPort* port)
   return port->symbol;
 }
 
+/// Return the lv2:name object that the name of a port is taken from
+static const SordNode*
+lilv_port_find_name(const LilvPlugin* const plugin, const LilvPort* const port)
+{
+  LilvWorld* const world = plugin->world;
+  return lilv_first_match(world, port->node->node, world->uris.lv2_name);
+}
+
+/// Return `name` if it's a string, otherwise warn and return null
+static const LilvNode*
+lilv_port_check_name(const LilvPlugin* const plugin, const LilvNode* const name)
+{
+  if (!lilv_node_is_string(name)) {
+    LILV_WARNF("Plugin <%s> port has no (mandatory) doap:name\n",
+               lilv_node_as_string(lilv_plugin_get_uri(plugin)));
+    return NULL;
+  }
+
+  return name;
+}
+
 LilvNode*
 lilv_port_get_name(const LilvPlugin* plugin, const LilvPort* port)
 {
-  LilvNodes* results =
-    lilv_port_get_value_by_node(plugin, port, plugin->world->uris.lv2_name);
+  LilvNode* const name =
+    lilv_node_new_from_node(plugin->world, lilv_port_find_name(plugin, port));
 
-  LilvNode* ret = NULL;
-  if (results) {
-    const LilvNode* val = lilv_nodes_get_first(results);
-    if (lilv_node_is_string(val)) {
-      ret = lilv_node_duplicate(val);
-    }
-    lilv_nodes_free(results);
+  if (!lilv_port_check_name(plugin, name)) {
+    lilv_node_free(name);
+    return NULL;
   }
 
-  if (!ret) {
-    LILV_WARNF("Plugin <%s> port has no (mandatory) doap:name\n",
-               lilv_node_as_string(lilv_plugin_get_uri(plugin)));
-  }
+  return name;
+}
 
-  return ret;
+const LilvNode*
+lilv_port_get_shared_name(const LilvPlugin* const plugin,
+                          const LilvPort* const   port)
+{
+  LilvWorld* const world = plugin->world;
+
+  return lilv_port_check_name(
+    plugin,
+    lilv_node_pool_intern(
+      world->shared_nodes, world, lilv_port_find_name(plugin, port)));
 }
 
 const LilvNodes*
@@ -215,41 +377,225 @@ lilv_port_get_range(const LilvPlugin* plugin,
   }
 }
 
-LilvScalePoints*
-lilv_port_get_scale_points(const LilvPlugin* plugin, const LilvPort* port)
+static const SordNode*
+lilv_port_unique_object(const SordNode* const subject,
+                        const SordNode* const predicate,
+                        const SordNode* const object,
+                        const unsigned        n_objects)
 {
-  SordIter* points = sord_search(plugin->world->model,
-                                 port->node->node,
-                                 plugin->world->uris.lv2_scalePoint,
-                                 NULL,
-                                 NULL);
+  if (n_objects > 1U) {
+    LILV_WARNF("Subject <%s> has multiple <%s> properties\n",
+               sord_node_get_string(subject),
+               sord_node_get_string(predicate));
+  }
 
-  if (!points) {
+  if (n_objects != 1U) {
+    LILV_ERRORF("No value found for (%s %s ...) property\n",
+                sord_node_get_string(subject),
+                sord_node_get_string(predicate));
     return NULL;
   }
 
-  LilvScalePoints* ret = lilv_scale_points_new();
+  return object;
+}
 
-  FOREACH_MATCH (points) {
-    const SordNode* point = sord_iter_get_node(points, SORD_OBJECT);
+static int
+lilv_scale_point_label_cmp(const void* const a, const void* const b)
+{
+  const LilvScalePoint* const pa = *(const LilvScalePoint* const*)a;
+  const LilvScalePoint* const pb = *(const LilvScalePoint* const*)b;
 
-    const SordNode* value = lilv_plugin_get_unique_internal(
-      plugin, point, plugin->world->uris.rdf_value);
+  const int st = strcmp(lilv_node_as_string(pa->label),
+                        lilv_node_as_string(pb->label));
 
-    const SordNode* label = lilv_plugin_get_unique_internal(
-      plugin, point, plugin->world->uris.rdfs_label);
+  return st ? st : lilv_scale_point_cmp(pa, pb, NULL);
+}
+
+static ScalePointIndex*
+lilv_port_load_scale_points(const LilvPlugin* const plugin,
+                            const LilvPort* const   port)
+{
+  LilvWorld* const world = plugin->world;
+  SordModel* const model = world->model;
+
+  ScalePointIndex* const index =
+    (ScalePointIndex*)calloc(1, sizeof(ScalePointIndex));
+  if (!index) {
+    return NULL;
+  }
+
+  SordIter* const points = sord_search(
+    model, port->node->node, world->uris.lv2_scalePoint, NULL, NULL);
+
+  FOREACH_MATCH (points) {
+    const SordNode* const point = sord_iter_get_node(points, SORD_OBJECT);
+
+    // Find the value and label in a single pass over the point's statements
+    const SordNode* value    = NULL;
+    const SordNode* label    = NULL;
+    unsigned        n_values = 0U;
+    unsigned        n_labels = 0U;
+    SordIter* const p        = sord_search(model, point, NULL, NULL, NULL);
+    FOREACH_MATCH (p) {
+      const SordNode* const pred = sord_iter_get_node(p, SORD_PREDICATE);
+      const SordNode* const obj  = sord_iter_get_node(p, SORD_OBJECT);
+      if (sord_node_equals(pred, world->uris.rdf_value)) {
+        value = n_values++ ? value : obj;
+      } else if (sord_node_equals(pred, world->uris.rdfs_label)) {
+        label = n_labels++ ? label : obj;
+      }
+    }
+    sord_iter_free(p);
+
+    value = lilv_port_unique_object(
+      point, world->uris.rdf_value, value, n_values);
+    label = lilv_port_unique_object(
+      point, world->uris.rdfs_label, label, n_labels);
 
     if (value && label) {
-      zix_tree_insert(
-        (ZixTree*)ret, lilv_scale_point_new(plugin->world, value, label), NULL);
+      if (!index->points) {
+        index->points = lilv_scale_points_new_sorted();
+      }
+
+      lilv_collection_insert(index->points,
+                             lilv_scale_point_new(world, value, label));
     }
   }
   sord_iter_free(points);
 
+  index->n_points = lilv_scale_points_size(index->points);
+  if (index->n_points) {
+    // Store both sorted orders in a single array
+    const unsigned n = index->n_points;
+    index->by_value =
+      (LilvScalePoint**)calloc(2U * (size_t)n, sizeof(LilvScalePoint*));
+    if (!index->by_value) {
+      lilv_port_free_scale_points(index);
+      return NULL;
+    }
+
+    index->by_label = index->by_value + n;
+
+    unsigned i = 0U;
+    LILV_FOREACH (scale_points, s, index->points) {
+      index->by_value[i++] =
+        (LilvScalePoint*)lilv_scale_points_get(index->points, s);
+    }
+
+    memcpy(index->by_label, index->by_value, n * sizeof(LilvScalePoint*));
+    qsort(index->by_label,
+          n,
+          sizeof(LilvScalePoint*),
+          lilv_scale_point_label_cmp);
+  }
+
+  return index;
+}
+
+/// Return the scale points of a port, loading them if necessary, or null
+static const ScalePointIndex*
+lilv_port_get_scale_point_index(const LilvPlugin* const plugin,
+                                const LilvPort* const   port)
+{
+  if (!port->scale_points) {
+    ((LilvPort*)port)->scale_points = lilv_port_load_scale_points(plugin, port);
+  }
+
+  return port->scale_points;
+}
+
+LilvScalePoints*
+lilv_port_get_scale_points(const LilvPlugin* plugin, const LilvPort* port)
+{
+  const ScalePointIndex* const index =
+    lilv_port_get_scale_point_index(plugin, port);
+
+  if (!index || !index->n_points) {
+    return NULL;
+  }
+
+  LilvScalePoints* ret = lilv_scale_points_new_sorted();
+  for (unsigned i = 0U; i < index->n_points; ++i) {
+    const LilvScalePoint* const point = index->by_value[i];
+
+    lilv_collection_insert(
+      ret,
+      lilv_scale_point_new(
+        plugin->world, point->value->node, point->label->node));
+  }
+
   assert(lilv_nodes_size(ret) > 0);
   return ret;
 }
 
+const LilvScalePoints*
+lilv_port_get_sorted_scale_points(const LilvPlugin* plugin,
+                                  const LilvPort*   port)
+{
+  const ScalePointIndex* const index =
+    lilv_port_get_scale_point_index(plugin, port);
+
+  return index ? index->points : NULL;
+}
+
+const LilvScalePoint*
+lilv_port_get_scale_point_by_value(const LilvPlugin* plugin,
+                                   const LilvPort*   port,
+                                   const float       value)
+{
+  const ScalePointIndex* const index =
+    lilv_port_get_scale_point_index(plugin, port);
+  if (!index) {
+    return NULL;
+  }
+
+  // Find the first point with a value not less than the given one
+  unsigned lo = 0U;
+  unsigned hi = index->n_points;
+  while (lo < hi) {
+    const unsigned mid    = lo + ((hi - lo) / 2U);
+    const float    number = index->by_value[mid]->number;
+    if (!isnan(number) && number < value) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return (lo < index->n_points && index->by_value[lo]->number == value)
+           ? index->by_value[lo]
+           : NULL;
+}
+
+const LilvScalePoint*
+lilv_port_get_scale_point_by_label(const LilvPlugin* plugin,
+                                   const LilvPort*   port,
+                                   const char*       label)
+{
+  const ScalePointIndex* const index =
+    lilv_port_get_scale_point_index(plugin, port);
+  if (!index) {
+    return NULL;
+  }
+
+  // Find the first point with a label not less than the given one
+  unsigned lo = 0U;
+  unsigned hi = index->n_points;
+  while (lo < hi) {
+    const unsigned mid = lo + ((hi - lo) / 2U);
+    if (strcmp(lilv_node_as_string(index->by_label[mid]->label), label) < 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return (lo < index->n_points &&
+          !strcmp(lilv_node_as_string(index->by_label[lo]->label), label))
+           ? index->by_label[lo]
+           : NULL;
+}
+
 LilvNodes*
 lilv_port_get_properties(const LilvPlugin* plugin, const LilvPort* port)
 {
@@ -0,0 +1,62 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE char
+#define ZIX_HASH_RECORD_TYPE LilvPort
+#define ZIX_HASH_SEARCH_DATA_TYPE char
+
+#include "port_hash.h"
+
+#include "lilv_internal.h"
+
+#include <lilv/lilv.h>
+#include <zix/attributes.h>
+#include <zix/digest.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+ZIX_PURE_FUNC static const char*
+port_symbol(const LilvPort* const port)
+{
+  return lilv_node_as_string(port->symbol);
+}
+
+ZIX_PURE_FUNC static size_t
+symbol_hash(const char* const symbol)
+{
+  return zix_digest(0U, symbol, strlen(symbol));
+}
+
+static bool
+symbol_equal(const char* const lhs, const char* const rhs)
+{
+  return !strcmp(lhs, rhs);
+}
+
+PortHash*
+lilv_port_hash_new(void)
+{
+  return zix_hash_new(NULL, port_symbol, symbol_hash, symbol_equal);
+}
+
+void
+lilv_port_hash_free(PortHash* const hash)
+{
+  zix_hash_free(hash);
+}
+
+LilvPort*
+lilv_port_hash_find(const PortHash* const hash, const char* const symbol)
+{
+  return zix_hash_find_record(hash, symbol);
+}
+
+ZixStatus
+lilv_port_hash_insert(PortHash* const hash, LilvPort* const port)
+{
+  return zix_hash_insert(hash, port);
+}
@@ -0,0 +1,31 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_PORT_HASH_H
+#define LILV_PORT_HASH_H
+
+#include <lilv/lilv.h>
+#include <zix/attributes.h>
+#include <zix/status.h>
+
+/// A hash of ports keyed by symbol, which doesn't own the ports
+typedef struct ZixHashImpl PortHash;
+
+/// Return a new empty port hash
+PortHash* ZIX_ALLOCATED
+lilv_port_hash_new(void);
+
+/// Free a port hash (but not the ports in it)
+void
+lilv_port_hash_free(PortHash* ZIX_NULLABLE hash);
+
+/// Return the port with the given symbol, or null
+LilvPort* ZIX_NULLABLE
+lilv_port_hash_find(const PortHash* ZIX_NONNULL hash,
+                    const char* ZIX_NONNULL     symbol);
+
+/// Add a port to the hash
+ZixStatus
+lilv_port_hash_insert(PortHash* ZIX_NONNULL hash, LilvPort* ZIX_NONNULL port);
+
+#endif // LILV_PORT_HASH_H
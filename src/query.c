@@ -7,8 +7,8 @@
 
 #include <lilv/lilv.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
 
+#include <stdbool.h>
 #include <string.h>
 
 typedef enum {
@@ -40,12 +40,16 @@ lilv_lang_matches(const char* a, const char* b)
   return LILV_LANG_MATCH_NONE;
 }
 
-static LilvNodes*
-lilv_nodes_from_matches_i18n(LilvWorld* const world, SordIter* const stream)
+/// Visit matching objects with the best available language
+static unsigned
+lilv_visit_matches_i18n(LilvWorld* const    world,
+                        SordIter* const     stream,
+                        const LilvMatchFunc func,
+                        void* const         data)
 {
-  LilvNodes*      values  = lilv_nodes_new();
-  const SordNode* partial = NULL; // Partial language match
-  const char*     syslang = world->lang;
+  unsigned        n_visited = 0U;
+  const SordNode* partial   = NULL; // Partial language match
+  const char*     syslang   = world->lang;
   FOREACH_MATCH (stream) {
     const SordNode* value = sord_iter_get_node(stream, SORD_OBJECT);
     if (sord_node_get_type(value) == SORD_LITERAL) {
@@ -58,9 +62,9 @@ lilv_nodes_from_matches_i18n(LilvWorld* const world, SordIter* const stream)
       } else {
         switch (lilv_lang_matches(lang, syslang)) {
         case LILV_LANG_MATCH_EXACT:
-          // Exact language match, add to results
-          zix_tree_insert(
-            (ZixTree*)values, lilv_node_new_from_node(world, value), NULL);
+          // Exact language match, visit
+          func(world, value, data);
+          ++n_visited;
           break;
         case LILV_LANG_MATCH_PARTIAL:
           // Partial language match, save in case we find no exact
@@ -71,43 +75,85 @@ lilv_nodes_from_matches_i18n(LilvWorld* const world, SordIter* const stream)
         }
       }
     } else {
-      zix_tree_insert(
-        (ZixTree*)values, lilv_node_new_from_node(world, value), NULL);
+      func(world, value, data);
+      ++n_visited;
     }
   }
+
+  if (!n_visited && partial) {
+    func(world, partial, data);
+    ++n_visited;
+  }
+
   sord_iter_free(stream);
+  return n_visited;
+}
 
-  if (lilv_nodes_size(values) > 0) {
-    return values;
+static unsigned
+lilv_visit_matches_all(LilvWorld* const    world,
+                       SordIter* const     stream,
+                       const SordQuadIndex field,
+                       const LilvMatchFunc func,
+                       void* const         data)
+{
+  unsigned n_visited = 0U;
+  FOREACH_MATCH (stream) {
+    func(world, sord_iter_get_node(stream, field), data);
+    ++n_visited;
   }
+  sord_iter_free(stream);
+  return n_visited;
+}
 
-  if (partial) {
-    zix_tree_insert(
-      (ZixTree*)values, lilv_node_new_from_node(world, partial), NULL);
+/// Select a literal by language, and return true if it is the best possible
+static bool
+lilv_select_object(const char* const      syslang,
+                   const SordNode* const  node,
+                   const SordNode** const best,
+                   const SordNode** const partial)
+{
+  if (sord_node_get_type(node) != SORD_LITERAL) {
+    *best = node;
+    return true; // Treat a non-literal as an exact match
+  }
+
+  const char* lang = sord_node_get_language(node);
+  if (!lang) {
+    if (!*partial) {
+      *partial = node;
+    }
   } else {
-    // No matches whatsoever
-    lilv_nodes_free(values);
-    values = NULL;
+    const LilvLangMatch match = lilv_lang_matches(lang, syslang);
+    if (match == LILV_LANG_MATCH_PARTIAL) {
+      *partial = node;
+    } else if (match == LILV_LANG_MATCH_EXACT) {
+      *best = node;
+      return true;
+    }
   }
 
-  return values;
+  return false;
 }
 
-static LilvNodes*
-lilv_nodes_from_matches_all(LilvWorld* const    world,
-                            SordIter* const     stream,
-                            const SordQuadIndex field)
+const SordNode*
+lilv_find_object(LilvWorld* const      world,
+                 const SordNode* const s,
+                 const SordNode* const p)
 {
-  LilvNodes* const values = lilv_nodes_new();
-  FOREACH_MATCH (stream) {
-    const SordNode* value = sord_iter_get_node(stream, field);
-    LilvNode*       node  = lilv_node_new_from_node(world, value);
-    if (node) {
-      zix_tree_insert((ZixTree*)values, node, NULL);
+  lilv_world_load_specs_for(world, s, p, NULL);
+
+  const SordNode* best    = NULL;
+  const SordNode* partial = NULL;
+  SordIter* const i       = sord_search(world->model, s, p, NULL, NULL);
+  FOREACH_MATCH (i) {
+    const SordNode* const node = sord_iter_get_node(i, SORD_OBJECT);
+    if (lilv_select_object(world->lang, node, &best, &partial)) {
+      break;
     }
   }
-  sord_iter_free(stream);
-  return values;
+
+  sord_iter_free(i);
+  return best ? best : partial;
 }
 
 LilvNode*
@@ -115,41 +161,133 @@ lilv_node_from_object(LilvWorld* const      world,
                       const SordNode* const s,
                       const SordNode* const p)
 {
-  SordIter* const i = sord_search(world->model, s, p, NULL, NULL);
-  if (sord_iter_end(i)) {
-    sord_iter_free(i);
-    return NULL;
-  }
+  return lilv_node_new_from_node(world, lilv_find_object(world, s, p));
+}
 
-  const char* const syslang = world->lang;
-  const SordNode*   best    = NULL;
-  const SordNode*   partial = NULL;
-  FOREACH_MATCH (i) {
-    const SordNode* const node = sord_iter_get_node(i, SORD_OBJECT);
-    if (sord_node_get_type(node) != SORD_LITERAL) {
-      best = node;
-      break; // Treat a non-literal as an exact match
+/// Maximum number of predicates selected in a single pass over a subject
+#define LILV_OBJECTS_BATCH_SIZE 16U
+
+/// Set values for a batch of predicates from a single walk over the subject
+static unsigned
+lilv_nodes_from_objects_batch(LilvWorld* const             world,
+                              const SordNode* const        s,
+                              const unsigned               n_predicates,
+                              const LilvNode* const* const predicates,
+                              LilvNode** const             values)
+{
+  // Best and partial matches for each predicate
+  const SordNode* matches[LILV_OBJECTS_BATCH_SIZE]  = {NULL};
+  const SordNode* partials[LILV_OBJECTS_BATCH_SIZE] = {NULL};
+
+  unsigned n_wanted = 0U;
+  for (unsigned k = 0U; k < n_predicates; ++k) {
+    if (predicates[k]) {
+      lilv_world_load_specs_for(world, s, predicates[k]->node, NULL);
+      ++n_wanted;
     }
+  }
 
-    const char* lang = sord_node_get_language(node);
-    if (!lang) {
-      if (!partial) {
-        partial = node;
-      }
-    } else {
-      const LilvLangMatch match = lilv_lang_matches(lang, syslang);
-      if (match == LILV_LANG_MATCH_PARTIAL) {
-        partial = node;
-      } else if (match == LILV_LANG_MATCH_EXACT) {
-        best = node;
-        break;
+  // Walk every statement about the subject once
+  unsigned        n_best = 0U;
+  SordIter* const i      = sord_search(world->model, s, NULL, NULL, NULL);
+  for (; n_best < n_wanted && !sord_iter_end(i); sord_iter_next(i)) {
+    const SordNode* const p = sord_iter_get_node(i, SORD_PREDICATE);
+    for (unsigned k = 0U; k < n_predicates; ++k) {
+      if (predicates[k] && predicates[k]->node == p && !matches[k] &&
+          lilv_select_object(world->lang,
+                             sord_iter_get_node(i, SORD_OBJECT),
+                             &matches[k],
+                             &partials[k])) {
+        ++n_best;
       }
     }
   }
-
   sord_iter_free(i);
 
-  return lilv_node_new_from_node(world, best ? best : partial);
+  unsigned n_values = 0U;
+  for (unsigned k = 0U; k < n_predicates; ++k) {
+    values[k] =
+      lilv_node_new_from_node(world, matches[k] ? matches[k] : partials[k]);
+
+    n_values += values[k] ? 1U : 0U;
+  }
+
+  return n_values;
+}
+
+unsigned
+lilv_nodes_from_objects(LilvWorld* const             world,
+                        const SordNode* const        s,
+                        const unsigned               n_predicates,
+                        const LilvNode* const* const predicates,
+                        LilvNode** const             values)
+{
+  unsigned n_values = 0U;
+  for (unsigned k = 0U; k < n_predicates; k += LILV_OBJECTS_BATCH_SIZE) {
+    const unsigned n_left = n_predicates - k;
+
+    n_values += lilv_nodes_from_objects_batch(
+      world,
+      s,
+      n_left < LILV_OBJECTS_BATCH_SIZE ? n_left : LILV_OBJECTS_BATCH_SIZE,
+      predicates + k,
+      values + k);
+  }
+
+  return n_values;
+}
+
+unsigned
+lilv_visit_matches(LilvWorld* const      world,
+                   const SordNode* const s,
+                   const SordNode* const p,
+                   const SordNode* const o,
+                   const SordNode* const g,
+                   const LilvMatchFunc   func,
+                   void* const           data)
+{
+  lilv_world_load_specs_for(world, s, p, o);
+
+  SordIter* const     stream = sord_search(world->model, s, p, o, g);
+  const SordQuadIndex field  = o ? SORD_SUBJECT : SORD_OBJECT;
+
+  return (field == SORD_OBJECT && world->opt.filter_lang)
+           ? lilv_visit_matches_i18n(world, stream, func, data)
+           : lilv_visit_matches_all(world, stream, field, func, data);
+}
+
+static void
+lilv_nodes_insert_match(LilvWorld* const      world,
+                        const SordNode* const node,
+                        void* const           data)
+{
+  LilvNode* const value = lilv_node_new_from_node(world, node);
+  if (value) {
+    lilv_collection_insert((LilvNodes*)data, value);
+  }
+}
+
+static void
+lilv_set_first_match(LilvWorld* const      world,
+                     const SordNode* const node,
+                     void* const           data)
+{
+  (void)world;
+
+  const SordNode** const first = (const SordNode**)data;
+  if (!*first) {
+    *first = node;
+  }
+}
+
+const SordNode*
+lilv_first_match(LilvWorld* const      world,
+                 const SordNode* const s,
+                 const SordNode* const p)
+{
+  const SordNode* first = NULL;
+  lilv_visit_matches(world, s, p, NULL, NULL, lilv_set_first_match, &first);
+  return first;
 }
 
 LilvNodes*
@@ -159,17 +297,46 @@ lilv_nodes_from_matches(LilvWorld* const      world,
                         const SordNode* const o,
                         const SordNode* const g)
 {
-  SordIter* const stream = sord_search(world->model, s, p, o, g);
-  if (sord_iter_end(stream)) {
-    sord_iter_free(stream);
+  LilvNodes* const values = lilv_nodes_new();
+  if (!lilv_visit_matches(world, s, p, o, g, lilv_nodes_insert_match, values)) {
+    lilv_nodes_free(values);
     return NULL;
   }
 
-  const SordQuadIndex field = o ? SORD_SUBJECT : SORD_OBJECT;
+  return values;
+}
 
-  return (field == SORD_OBJECT && world->opt.filter_lang)
-           ? lilv_nodes_from_matches_i18n(world, stream)
-           : lilv_nodes_from_matches_all(world, stream, field);
+typedef struct {
+  LilvNodeFunc func;
+  void*        user_data;
+} NodeVisitor;
+
+static void
+lilv_visit_node(LilvWorld* const      world,
+                const SordNode* const node,
+                void* const           data)
+{
+  const NodeVisitor* const visitor = (const NodeVisitor*)data;
+
+  LilvNode view;
+  lilv_node_init_view(&view, world, node);
+  if (view.node) {
+    visitor->func(visitor->user_data, &view);
+  }
+
+  lilv_node_clear_view(&view);
+}
+
+unsigned
+lilv_visit_nodes(LilvWorld* const      world,
+                 const SordNode* const s,
+                 const SordNode* const p,
+                 const SordNode* const o,
+                 const LilvNodeFunc    func,
+                 void* const           user_data)
+{
+  NodeVisitor visitor = {func, user_data};
+  return lilv_visit_matches(world, s, p, o, NULL, lilv_visit_node, &visitor);
 }
 
 NodeHash*
@@ -11,9 +11,67 @@
 
 #define FOREACH_MATCH(iter) for (; !sord_iter_end(iter); sord_iter_next(iter))
 
+/// Function called with each node that matches a query
+typedef void (*LilvMatchFunc)(LilvWorld*      world,
+                              const SordNode* node,
+                              void*           data);
+
+/**
+   Return the object of a statement with the best language, or null.
+
+   Like the other queries here, this first loads any lazy specifications that
+   define terms in the pattern, so every accessor that uses them sees the same
+   data as the world queries.
+*/
+const SordNode*
+lilv_find_object(LilvWorld* world, const SordNode* s, const SordNode* p);
+
 LilvNode*
 lilv_node_from_object(LilvWorld* world, const SordNode* s, const SordNode* p);
 
+/**
+   Set each value to the best object of a predicate, and return the count.
+
+   This walks every statement about the subject once for each batch of up to
+   16 predicates, and selects objects the same way as lilv_node_from_object().
+   Every value is set, to null if there is no object (or no predicate).
+*/
+unsigned
+lilv_nodes_from_objects(LilvWorld*             world,
+                        const SordNode*        s,
+                        unsigned               n_predicates,
+                        const LilvNode* const* predicates,
+                        LilvNode**             values);
+
+/**
+   Call `func` with every match of a pattern, and return the number of calls.
+
+   The subjects are visited if `o` is given, otherwise the objects are.  If
+   language filtering is enabled, then only the literal objects with the best
+   matching language are visited, as with lilv_nodes_from_matches().
+*/
+unsigned
+lilv_visit_matches(LilvWorld*      world,
+                   const SordNode* s,
+                   const SordNode* p,
+                   const SordNode* o,
+                   const SordNode* g,
+                   LilvMatchFunc   func,
+                   void*           data);
+
+/// Return the first object that lilv_visit_matches() would visit, or null
+const SordNode*
+lilv_first_match(LilvWorld* world, const SordNode* s, const SordNode* p);
+
+/// Like lilv_visit_matches(), but call a public function with borrowed nodes
+unsigned
+lilv_visit_nodes(LilvWorld*      world,
+                 const SordNode* s,
+                 const SordNode* p,
+                 const SordNode* o,
+                 LilvNodeFunc    func,
+                 void*           user_data);
+
 LilvNodes*
 lilv_nodes_from_matches(LilvWorld*      world,
                         const SordNode* s,
@@ -0,0 +1,155 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE QueryRecord
+#define ZIX_HASH_RECORD_TYPE QueryRecord
+#define ZIX_HASH_SEARCH_DATA_TYPE QueryRecord
+
+#include "query_cache.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/digest.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+struct QueryCacheImpl {
+  ZixHash* records;    ///< Results keyed by pattern
+  size_t   max_size;   ///< Maximum number of records
+  unsigned generation; ///< World generation of records
+};
+
+ZIX_PURE_FUNC static const QueryRecord*
+query_pattern(const QueryRecord* const record)
+{
+  return record;
+}
+
+ZIX_PURE_FUNC static size_t
+query_pattern_hash(const QueryRecord* const pattern)
+{
+  const SordNode* const nodes[3] = {pattern->s, pattern->p, pattern->o};
+
+  return zix_digest_aligned(0U, nodes, sizeof(nodes));
+}
+
+static bool
+query_pattern_equal(const QueryRecord* const lhs, const QueryRecord* const rhs)
+{
+  return lhs->s == rhs->s && lhs->p == rhs->p && lhs->o == rhs->o;
+}
+
+static ZixHash*
+new_records(void)
+{
+  return zix_hash_new(
+    NULL, query_pattern, query_pattern_hash, query_pattern_equal);
+}
+
+/// Free every record in the cache, leaving it with no hash
+static void
+lilv_query_cache_clear(QueryCache* const cache, SordWorld* const world)
+{
+  ZixHash* const hash = cache->records;
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      QueryRecord* const record = zix_hash_get(hash, i);
+      sord_node_free(world, record->s);
+      sord_node_free(world, record->p);
+      sord_node_free(world, record->o);
+      sord_node_free(world, record->result);
+      free(record);
+    }
+
+    zix_hash_free(hash);
+    cache->records = NULL;
+  }
+}
+
+QueryCache*
+lilv_query_cache_new(const size_t max_size)
+{
+  QueryCache* const cache = (QueryCache*)calloc(1, sizeof(QueryCache));
+  if (cache) {
+    cache->max_size = max_size;
+  }
+
+  return cache;
+}
+
+void
+lilv_query_cache_free(QueryCache* const cache, SordWorld* const world)
+{
+  if (cache) {
+    lilv_query_cache_clear(cache, world);
+    free(cache);
+  }
+}
+
+void
+lilv_query_cache_update(QueryCache* const cache,
+                        SordWorld* const  world,
+                        const unsigned    generation)
+{
+  if (generation != cache->generation) {
+    lilv_query_cache_clear(cache, world);
+    cache->generation = generation;
+  }
+}
+
+const QueryRecord*
+lilv_query_cache_find(const QueryCache* const cache,
+                      const SordNode* const   s,
+                      const SordNode* const   p,
+                      const SordNode* const   o)
+{
+  const QueryRecord pattern = {(SordNode*)s, (SordNode*)p, (SordNode*)o, NULL};
+
+  return cache->records ? zix_hash_find_record(cache->records, &pattern)
+                        : NULL;
+}
+
+ZixStatus
+lilv_query_cache_insert(QueryCache* const     cache,
+                        SordWorld* const      world,
+                        const SordNode* const s,
+                        const SordNode* const p,
+                        const SordNode* const o,
+                        SordNode* const       result)
+{
+  // Start again with an empty hash when the cache is full
+  if (cache->records && zix_hash_size(cache->records) >= cache->max_size) {
+    lilv_query_cache_clear(cache, world);
+  }
+
+  if (!cache->records && !(cache->records = new_records())) {
+    return ZIX_STATUS_NO_MEM;
+  }
+
+  QueryRecord* const record = (QueryRecord*)malloc(sizeof(QueryRecord));
+  if (!record) {
+    return ZIX_STATUS_NO_MEM;
+  }
+
+  record->s      = (SordNode*)s;
+  record->p      = (SordNode*)p;
+  record->o      = (SordNode*)o;
+  record->result = result;
+
+  const ZixStatus st = zix_hash_insert(cache->records, record);
+  if (st) {
+    free(record);
+    return st;
+  }
+
+  // References for the pattern, released when the record is dropped
+  sord_node_copy(s);
+  sord_node_copy(p);
+  sord_node_copy(o);
+  return ZIX_STATUS_SUCCESS;
+}
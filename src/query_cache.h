@@ -0,0 +1,67 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_QUERY_CACHE_H
+#define LILV_QUERY_CACHE_H
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/status.h>
+
+#include <stddef.h>
+
+/// The remembered result of a query for a single node
+typedef struct {
+  SordNode* ZIX_NULLABLE s;      ///< Subject of pattern
+  SordNode* ZIX_NULLABLE p;      ///< Predicate of pattern
+  SordNode* ZIX_NULLABLE o;      ///< Object of pattern
+  SordNode* ZIX_NULLABLE result; ///< Matching node, or null
+} QueryRecord;
+
+/**
+   A bounded cache of single-node query results.
+
+   Results are keyed by the interned nodes of the query pattern, and are only
+   valid for one generation of the world, so the whole cache is dropped if the
+   model has changed since results were added.  It is also dropped when it's
+   full, which is simple and keeps frequently repeated queries cached.
+*/
+typedef struct QueryCacheImpl QueryCache;
+
+/// Return a new empty cache that holds at most `max_size` results
+QueryCache* ZIX_ALLOCATED
+lilv_query_cache_new(size_t max_size);
+
+/// Free a query cache and drop its references to nodes in `world`
+void
+lilv_query_cache_free(QueryCache* ZIX_NULLABLE cache,
+                      SordWorld* ZIX_NONNULL   world);
+
+/// Drop every result if the cache was filled in a different generation
+void
+lilv_query_cache_update(QueryCache* ZIX_NONNULL cache,
+                        SordWorld* ZIX_NONNULL  world,
+                        unsigned                generation);
+
+/// Return the result of a query, or null if it isn't cached
+const QueryRecord* ZIX_NULLABLE
+lilv_query_cache_find(const QueryCache* ZIX_NONNULL cache,
+                      const SordNode* ZIX_NULLABLE  s,
+                      const SordNode* ZIX_NULLABLE  p,
+                      const SordNode* ZIX_NULLABLE  o);
+
+/**
+   Add the result of a query.
+
+   On success, the cache takes ownership of the reference to `result`, and
+   adds references to the pattern nodes.
+*/
+ZixStatus
+lilv_query_cache_insert(QueryCache* ZIX_NONNULL      cache,
+                        SordWorld* ZIX_NONNULL       world,
+                        const SordNode* ZIX_NULLABLE s,
+                        const SordNode* ZIX_NULLABLE p,
+                        const SordNode* ZIX_NULLABLE o,
+                        SordNode* ZIX_NULLABLE       result);
+
+#endif // LILV_QUERY_CACHE_H
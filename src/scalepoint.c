@@ -6,7 +6,9 @@
 #include <lilv/lilv.h>
 #include <sord/sord.h>
 
+#include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 LilvScalePoint*
 lilv_scale_point_new(LilvWorld* const      world,
@@ -16,9 +18,38 @@ lilv_scale_point_new(LilvWorld* const      world,
   LilvScalePoint* point = (LilvScalePoint*)malloc(sizeof(LilvScalePoint));
   point->value          = lilv_node_new_from_node(world, value);
   point->label          = lilv_node_new_from_node(world, label);
+  point->number         = lilv_node_as_float(point->value);
   return point;
 }
 
+int
+lilv_scale_point_cmp(const void* a, const void* b, const void* user_data)
+{
+  (void)user_data;
+
+  const LilvScalePoint* const pa = (const LilvScalePoint*)a;
+  const LilvScalePoint* const pb = (const LilvScalePoint*)b;
+
+  // Order by numeric value with non-numeric values last
+  if (isnan(pa->number) != isnan(pb->number)) {
+    return isnan(pa->number) ? 1 : -1;
+  }
+
+  if (pa->number < pb->number) {
+    return -1;
+  }
+
+  if (pb->number < pa->number) {
+    return 1;
+  }
+
+  // Order points with the same value by label, then by address
+  const int st = strcmp(lilv_node_as_string(pa->label),
+                        lilv_node_as_string(pb->label));
+
+  return st ? st : lilv_ptr_cmp(a, b, NULL);
+}
+
 void
 lilv_scale_point_free(LilvScalePoint* point)
 {
@@ -0,0 +1,552 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "search.h"
+
+#include "lilv_internal.h"
+#include "query.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// A searchable field of a plugin, in the order of LilvSearchFlag bits
+typedef enum {
+  SEARCH_FIELD_NAME,
+  SEARCH_FIELD_AUTHOR,
+  SEARCH_FIELD_CLASS,
+  SEARCH_FIELD_URI,
+} SearchField;
+
+#define N_SEARCH_FIELDS 4U
+
+/// Score of a match in each field, so names are the most relevant
+static const unsigned field_weights[N_SEARCH_FIELDS] = {8U, 2U, 4U, 1U};
+
+/// Score multipliers for how well a query word matches
+enum {
+  MATCH_SUBSTRING = 1U, ///< Query word is within a word
+  MATCH_PREFIX    = 2U, ///< Query word is the start of a word
+  MATCH_WORD      = 4U, ///< Query word is an entire word
+};
+
+/// The indexed text of a plugin
+typedef struct {
+  const LilvPlugin* plugin;                  ///< Plugin this entry is for
+  char*             text[N_SEARCH_FIELDS];   ///< Lowercase values per line
+  size_t            length[N_SEARCH_FIELDS]; ///< Length of each text
+  uint32_t          pos;                     ///< Position in entry array
+  unsigned          class_epoch;             ///< Class index epoch of text
+  bool              loaded;                  ///< Plugin data was indexed
+  bool              stale;                   ///< Text must be read again
+} SearchEntry;
+
+/// A word in the text of a plugin
+typedef struct {
+  const char*  word;   ///< Start of word in the entry text
+  uint32_t     length; ///< Length of word in bytes
+  SearchField  field;  ///< Field that contains the word
+  SearchEntry* entry;  ///< Entry that contains the word
+} SearchToken;
+
+struct SearchIndexImpl {
+  SearchEntry** entries;  ///< All entries, in no particular order
+  SearchToken*  tokens;   ///< Words in all entries, sorted
+  uint32_t      n_entries;
+  uint32_t      n_tokens;
+  uint32_t      tokens_capacity;
+};
+
+static bool
+is_word_char(const char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || ((unsigned char)c >= 0x80U);
+}
+
+static char
+to_lower(const char c)
+{
+  return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static int
+word_cmp(const char* const a,
+         const size_t      a_len,
+         const char* const b,
+         const size_t      b_len)
+{
+  const int cmp = memcmp(a, b, a_len < b_len ? a_len : b_len);
+  if (cmp || a_len == b_len) {
+    return cmp;
+  }
+
+  return a_len < b_len ? -1 : 1;
+}
+
+static int
+token_cmp(const void* const a, const void* const b)
+{
+  const SearchToken* const ta = (const SearchToken*)a;
+  const SearchToken* const tb = (const SearchToken*)b;
+
+  return word_cmp(ta->word, ta->length, tb->word, tb->length);
+}
+
+SearchIndex*
+lilv_search_index_new(void)
+{
+  return (SearchIndex*)calloc(1, sizeof(SearchIndex));
+}
+
+static void
+entry_clear_text(SearchEntry* const entry)
+{
+  for (unsigned f = 0U; f < N_SEARCH_FIELDS; ++f) {
+    free(entry->text[f]);
+    entry->text[f]   = NULL;
+    entry->length[f] = 0U;
+  }
+}
+
+void
+lilv_search_index_free(SearchIndex* const index)
+{
+  if (index) {
+    for (uint32_t i = 0U; i < index->n_entries; ++i) {
+      entry_clear_text(index->entries[i]);
+      free(index->entries[i]);
+    }
+
+    free(index->entries);
+    free(index->tokens);
+    free(index);
+  }
+}
+
+void
+lilv_search_index_add(SearchIndex* const index, const LilvPlugin* const plugin)
+{
+  SearchEntry** const entries = (SearchEntry**)realloc(
+    index->entries, (index->n_entries + 1U) * sizeof(SearchEntry*));
+  if (!entries) {
+    return;
+  }
+
+  SearchEntry* const entry = (SearchEntry*)calloc(1, sizeof(SearchEntry));
+  if (!entry) {
+    index->entries = entries;
+    return;
+  }
+
+  entry->plugin               = plugin;
+  entry->pos                  = index->n_entries;
+  entry->stale                = true;
+  entries[index->n_entries++] = entry;
+  index->entries              = entries;
+}
+
+/// Remove the tokens of all stale entries
+static void
+remove_stale_tokens(SearchIndex* const index)
+{
+  uint32_t n = 0U;
+  for (uint32_t i = 0U; i < index->n_tokens; ++i) {
+    if (!index->tokens[i].entry->stale) {
+      index->tokens[n++] = index->tokens[i];
+    }
+  }
+
+  index->n_tokens = n;
+}
+
+void
+lilv_search_index_remove(SearchIndex* const      index,
+                         const LilvPlugin* const plugin)
+{
+  for (uint32_t i = 0U; i < index->n_entries; ++i) {
+    SearchEntry* const entry = index->entries[i];
+    if (entry->plugin == plugin) {
+      entry->stale = true;
+      remove_stale_tokens(index);
+
+      // Move the last entry into this position
+      index->entries[i]      = index->entries[--index->n_entries];
+      index->entries[i]->pos = i;
+
+      entry_clear_text(entry);
+      free(entry);
+      return;
+    }
+  }
+}
+
+/// Append a lowercase value to a text, separated by a newline
+static void
+append_text(SearchEntry* const    entry,
+            const SearchField     field,
+            const SordNode* const node)
+{
+  if (!node || sord_node_get_type(node) == SORD_BLANK) {
+    return;
+  }
+
+  size_t            len = 0U;
+  const char* const str = (const char*)sord_node_get_string_counted(node, &len);
+  const size_t      old = entry->length[field];
+  const size_t      sep = old ? 1U : 0U;
+
+  char* const text = (char*)realloc(entry->text[field], old + sep + len + 1U);
+  if (!text) {
+    return;
+  }
+
+  if (sep) {
+    text[old] = '\n';
+  }
+
+  for (size_t i = 0U; i < len; ++i) {
+    text[old + sep + i] = to_lower(str[i]);
+  }
+
+  text[old + sep + len] = '\0';
+  entry->text[field]    = text;
+  entry->length[field]  = old + sep + len;
+}
+
+/// Append every object of a pattern to a text
+static void
+append_objects(const LilvWorld* const world,
+               SearchEntry* const     entry,
+               const SearchField      field,
+               const SordNode* const  subject,
+               const SordNode* const  predicate)
+{
+  SordIter* const i = sord_search(world->model, subject, predicate, NULL, NULL);
+  FOREACH_MATCH (i) {
+    append_text(entry, field, sord_iter_get_node(i, SORD_OBJECT));
+  }
+  sord_iter_free(i);
+}
+
+/// Append the names of the maintainers of a subject, and return their count
+static unsigned
+append_maintainers(const LilvWorld* const world,
+                   SearchEntry* const     entry,
+                   const SordNode* const  subject)
+{
+  unsigned        n_maintainers = 0U;
+  SordIter* const i             = sord_search(
+    world->model, subject, world->uris.doap_maintainer, NULL, NULL);
+  FOREACH_MATCH (i) {
+    const SordNode* const maintainer = sord_iter_get_node(i, SORD_OBJECT);
+    append_objects(
+      world, entry, SEARCH_FIELD_AUTHOR, maintainer, world->uris.foaf_name);
+    ++n_maintainers;
+  }
+  sord_iter_free(i);
+  return n_maintainers;
+}
+
+/// Append the labels of every class of the plugin and their ancestors
+static void
+append_classes(const LilvWorld* const world, SearchEntry* const entry)
+{
+  const ClassIndex* const index   = &world->class_index;
+  uint64_t* const         classes = lilv_plugin_new_class_set(entry->plugin);
+  if (!classes) {
+    return;
+  }
+
+  // Every plugin is an lv2:Plugin, so that label isn't useful to search
+  for (uint32_t c = 0U; c < index->n_classes; ++c) {
+    const LilvNode* const label = index->classes[c]->label;
+    if (c != world->lv2_plugin_class->id && label &&
+        (classes[c / 64U] & (1ULL << (c % 64U)))) {
+      append_text(entry, SEARCH_FIELD_CLASS, label->node);
+    }
+  }
+
+  free(classes);
+}
+
+/// Append the tokens of every word in a field of an entry
+static void
+add_tokens(SearchIndex* const index,
+           SearchEntry* const entry,
+           const SearchField  field)
+{
+  const char* const text = entry->text[field];
+  const size_t      len  = entry->length[field];
+
+  for (size_t i = 0U; i < len;) {
+    if (!is_word_char(text[i])) {
+      ++i;
+      continue;
+    }
+
+    const size_t start = i;
+    while (i < len && is_word_char(text[i])) {
+      ++i;
+    }
+
+    if (index->n_tokens == index->tokens_capacity) {
+      const uint32_t capacity = index->tokens_capacity
+                                  ? (index->tokens_capacity * 2U)
+                                  : 256U;
+      SearchToken* const tokens = (SearchToken*)realloc(
+        index->tokens, capacity * sizeof(SearchToken));
+      if (!tokens) {
+        return;
+      }
+
+      index->tokens          = tokens;
+      index->tokens_capacity = capacity;
+    }
+
+    SearchToken* const token = &index->tokens[index->n_tokens++];
+    token->word              = text + start;
+    token->length            = (uint32_t)(i - start);
+    token->field             = field;
+    token->entry             = entry;
+  }
+}
+
+/// Read the text of an entry from the model and add its tokens
+static void
+index_entry(LilvWorld* const   world,
+            SearchIndex* const index,
+            SearchEntry* const entry)
+{
+  const LilvPlugin* const plugin = entry->plugin;
+  const SordNode* const   uri    = plugin->plugin_uri->node;
+
+  // Only index data that is already loaded, see update_index()
+  entry_clear_text(entry);
+
+  append_objects(world, entry, SEARCH_FIELD_NAME, uri, world->uris.doap_name);
+
+  // Use the maintainers of the project if the plugin has none (like authors)
+  if (!append_maintainers(world, entry, uri)) {
+    const SordNode* const project =
+      sord_get(world->model, uri, world->uris.lv2_project, NULL, NULL);
+    if (project) {
+      append_maintainers(world, entry, project);
+      sord_node_free(world->world, (SordNode*)project);
+    }
+  }
+
+  append_classes(world, entry);
+  append_text(entry, SEARCH_FIELD_URI, uri);
+
+  for (unsigned f = 0U; f < N_SEARCH_FIELDS; ++f) {
+    add_tokens(index, entry, (SearchField)f);
+  }
+
+  entry->class_epoch = world->class_index.epoch;
+  entry->loaded      = plugin->loaded;
+  entry->stale       = false;
+}
+
+/**
+   Re-index every entry that is stale or was indexed with different classes.
+
+   Entries are also re-indexed if their plugin data has been loaded since they
+   were indexed.  If `load` is true, then the data of every plugin is loaded
+   first, otherwise only what's already loaded (like the manifest) is indexed.
+*/
+static void
+update_index(LilvWorld* const world, SearchIndex* const index, const bool load)
+{
+  lilv_world_update_plugin_classes(world);
+
+  bool changed = false;
+  for (uint32_t i = 0U; i < index->n_entries; ++i) {
+    SearchEntry* const entry = index->entries[i];
+    if (load) {
+      lilv_plugin_load_if_necessary(entry->plugin);
+    }
+
+    if (entry->class_epoch != world->class_index.epoch ||
+        entry->loaded != entry->plugin->loaded) {
+      entry->stale = true;
+    }
+
+    changed = changed || entry->stale;
+  }
+
+  if (changed) {
+    remove_stale_tokens(index);
+    for (uint32_t i = 0U; i < index->n_entries; ++i) {
+      if (index->entries[i]->stale) {
+        index_entry(world, index, index->entries[i]);
+      }
+    }
+
+    qsort(index->tokens, index->n_tokens, sizeof(SearchToken), token_cmp);
+  }
+}
+
+/// Return the index of the first token not less than a word
+static uint32_t
+find_tokens(const SearchIndex* const index,
+            const char* const        word,
+            const size_t             length)
+{
+  uint32_t lo = 0U;
+  uint32_t hi = index->n_tokens;
+  while (lo < hi) {
+    const uint32_t           mid   = lo + ((hi - lo) / 2U);
+    const SearchToken* const token = &index->tokens[mid];
+    if (word_cmp(token->word, token->length, word, length) < 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+/// Score the best match of a query word in every entry
+static void
+score_word(const SearchIndex* const index,
+           const char* const        word,
+           const uint32_t           flags,
+           unsigned* const          scores)
+{
+  const size_t length = strlen(word);
+
+  // Find words that start with the query word in the sorted tokens
+  for (uint32_t t = find_tokens(index, word, length);
+       t < index->n_tokens && index->tokens[t].length >= length &&
+       !memcmp(index->tokens[t].word, word, length);
+       ++t) {
+    const SearchToken* const token = &index->tokens[t];
+    if (flags & (1U << token->field)) {
+      const bool     whole = token->length == length;
+      const unsigned match = whole ? MATCH_WORD : MATCH_PREFIX;
+      const unsigned score = field_weights[token->field] * match;
+      const uint32_t pos   = token->entry->pos;
+      if (score > scores[pos]) {
+        scores[pos] = score;
+      }
+    }
+  }
+
+  if (!(flags & LILV_SEARCH_SUBSTRING)) {
+    return;
+  }
+
+  // Scan the text of entries without a better match for the word anywhere
+  for (uint32_t e = 0U; e < index->n_entries; ++e) {
+    const SearchEntry* const entry = index->entries[e];
+    for (unsigned f = 0U; f < N_SEARCH_FIELDS; ++f) {
+      const unsigned score = field_weights[f] * MATCH_SUBSTRING;
+      if ((flags & (1U << f)) && score > scores[e] && entry->text[f] &&
+          strstr(entry->text[f], word)) {
+        scores[e] = score;
+      }
+    }
+  }
+}
+
+static int
+result_cmp(const void* const a, const void* const b)
+{
+  const LilvSearchResult* const ra = (const LilvSearchResult*)a;
+  const LilvSearchResult* const rb = (const LilvSearchResult*)b;
+
+  if (ra->score != rb->score) {
+    return ra->score > rb->score ? -1 : 1;
+  }
+
+  return strcmp(lilv_node_as_uri(ra->plugin->plugin_uri),
+                lilv_node_as_uri(rb->plugin->plugin_uri));
+}
+
+LilvSearchResult*
+lilv_search_index_search(SearchIndex* const index,
+                         LilvWorld* const   world,
+                         const char* const  query,
+                         uint32_t           flags,
+                         unsigned* const    n_results)
+{
+  *n_results = 0U;
+
+  update_index(world, index, flags & LILV_SEARCH_LOAD);
+
+  const uint32_t all_fields = LILV_SEARCH_NAME | LILV_SEARCH_AUTHOR |
+                                     LILV_SEARCH_CLASS | LILV_SEARCH_URI;
+  if (!(flags & all_fields)) {
+    flags |= all_fields;
+  }
+
+  // Copy the query and split it into lowercase words in place
+  const size_t    query_len = strlen(query);
+  const size_t    n_entries = index->n_entries + 1U;
+  char* const     words     = (char*)calloc(query_len + 1U, 1U);
+  unsigned* const counts =
+    (unsigned*)calloc(n_entries, 3U * sizeof(unsigned));
+  if (!words || !counts) {
+    free(counts);
+    free(words);
+    return NULL;
+  }
+
+  for (size_t i = 0U; i < query_len; ++i) {
+    words[i] = is_word_char(query[i]) ? to_lower(query[i]) : '\0';
+  }
+
+  // Score each word, keeping the total score and matched words of each entry
+  unsigned* const totals  = counts;
+  unsigned* const matches = counts + n_entries;
+  unsigned* const scores  = counts + (2U * n_entries);
+  unsigned        n_words = 0U;
+  for (size_t i = 0U; i < query_len; ++i) {
+    if (words[i] && (i == 0U || !words[i - 1U])) {
+      memset(scores, 0, n_entries * sizeof(unsigned));
+      score_word(index, words + i, flags, scores);
+      for (uint32_t e = 0U; e < index->n_entries; ++e) {
+        if (scores[e]) {
+          totals[e] += scores[e];
+          ++matches[e];
+        }
+      }
+
+      ++n_words;
+    }
+  }
+
+  // Collect entries that matched every word, ordered by score
+  LilvSearchResult* results = NULL;
+  if (n_words) {
+    results = (LilvSearchResult*)calloc(n_entries, sizeof(LilvSearchResult));
+    for (uint32_t e = 0U; results && e < index->n_entries; ++e) {
+      if (matches[e] == n_words) {
+        results[*n_results].plugin = index->entries[e]->plugin;
+        results[*n_results].score  = totals[e];
+        ++*n_results;
+      }
+    }
+
+    if (results) {
+      qsort(results, *n_results, sizeof(LilvSearchResult), result_cmp);
+    }
+  }
+
+  free(counts);
+  free(words);
+
+  if (!*n_results) {
+    free(results);
+    return NULL;
+  }
+
+  return results;
+}
@@ -0,0 +1,49 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_SEARCH_H
+#define LILV_SEARCH_H
+
+#include <lilv/lilv.h>
+#include <zix/attributes.h>
+
+#include <stdint.h>
+
+/**
+   A text search index of plugins.
+
+   This indexes the names, authors, class labels, and URIs of plugins as sorted
+   lists of lowercase words.  Plugins are added and removed as bundles are
+   loaded and unloaded, and the text of each plugin is read lazily before the
+   next search, and again if the plugin classes change or its data is loaded.
+   Plugin data is only loaded for indexing if the search asks for it.
+*/
+typedef struct SearchIndexImpl SearchIndex;
+
+/// Return a new empty search index
+SearchIndex* ZIX_ALLOCATED
+lilv_search_index_new(void);
+
+/// Free a search index
+void
+lilv_search_index_free(SearchIndex* ZIX_NULLABLE index);
+
+/// Add a plugin to the index
+void
+lilv_search_index_add(SearchIndex* ZIX_NONNULL      index,
+                      const LilvPlugin* ZIX_NONNULL plugin);
+
+/// Remove a plugin from the index
+void
+lilv_search_index_remove(SearchIndex* ZIX_NONNULL      index,
+                         const LilvPlugin* ZIX_NONNULL plugin);
+
+/// Search the index, see lilv_world_search_plugins()
+LilvSearchResult* ZIX_ALLOCATED
+lilv_search_index_search(SearchIndex* ZIX_NONNULL index,
+                         LilvWorld* ZIX_NONNULL   world,
+                         const char* ZIX_NONNULL  query,
+                         uint32_t                 flags,
+                         unsigned* ZIX_NONNULL    n_results);
+
+#endif // LILV_SEARCH_H
@@ -0,0 +1,424 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "snapshot.h"
+
+#include "load_skimmer.h"
+#include "mapped_file.h"
+
+#include <serd/serd.h>
+#include <sord/sord.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+  Each node record is packed as:
+
+  - uint8_t: Node type (SordNodeType)
+  - uint32_t: Datatype node index plus one, or zero
+  - uint32_t: Language tag length plus one, or zero
+  - Language tag, with null terminator
+  - uint32_t: String length
+  - String, with null terminator
+
+  Integers are in native byte order and may be unaligned.  Datatypes always
+  refer to an earlier record, so records can be interned in order.
+*/
+
+/// A reference to a node record
+typedef struct {
+  uint32_t index;  ///< Index of record plus one, or zero
+  size_t   offset; ///< Offset of record in nodes buffer
+} NodeRef;
+
+/// Parsing state used only while reading a snapshot
+typedef struct {
+  Snapshot* snapshot;
+  SerdEnv*  env;
+  NodeRef   last_subject;
+  NodeRef   last_predicate;
+} SnapshotReader;
+
+static bool
+reserve_nodes(Snapshot* const snapshot, const size_t size)
+{
+  const size_t needed = snapshot->nodes_size + size;
+  if (needed > snapshot->nodes_capacity) {
+    size_t new_capacity =
+      snapshot->nodes_capacity ? snapshot->nodes_capacity : 4096U;
+    while (new_capacity < needed) {
+      new_capacity *= 2U;
+    }
+
+    uint8_t* const new_nodes = (uint8_t*)realloc(snapshot->nodes, new_capacity);
+    if (!new_nodes) {
+      return false;
+    }
+
+    snapshot->nodes          = new_nodes;
+    snapshot->nodes_capacity = new_capacity;
+  }
+
+  return true;
+}
+
+static void
+write_u32(Snapshot* const snapshot, const uint32_t value)
+{
+  memcpy(snapshot->nodes + snapshot->nodes_size, &value, sizeof(value));
+  snapshot->nodes_size += sizeof(value);
+}
+
+static void
+write_string(Snapshot* const snapshot, const uint8_t* const str, size_t len)
+{
+  memcpy(snapshot->nodes + snapshot->nodes_size, str, len);
+  snapshot->nodes[snapshot->nodes_size + len] = '\0';
+  snapshot->nodes_size += len + 1U;
+}
+
+static uint32_t
+read_u32(const uint8_t* const ptr)
+{
+  uint32_t value = 0U;
+  memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+/// Append a node record and return its index plus one, or zero on error
+static uint32_t
+append_node(Snapshot* const      snapshot,
+            const SordNodeType   type,
+            const uint8_t* const str,
+            const size_t         len,
+            const uint32_t       datatype,
+            const uint8_t* const lang,
+            const size_t         lang_len)
+{
+  const size_t size =
+    1U + (3U * sizeof(uint32_t)) + (lang ? lang_len + 1U : 0U) + len + 1U;
+
+  if (len > UINT32_MAX - 1U || lang_len > UINT32_MAX - 1U ||
+      snapshot->n_nodes == UINT32_MAX - 1U || !reserve_nodes(snapshot, size)) {
+    return 0U;
+  }
+
+  snapshot->nodes[snapshot->nodes_size++] = (uint8_t)type;
+  write_u32(snapshot, datatype);
+  if (lang) {
+    write_u32(snapshot, (uint32_t)lang_len + 1U);
+    write_string(snapshot, lang, lang_len);
+  } else {
+    write_u32(snapshot, 0U);
+  }
+
+  write_u32(snapshot, (uint32_t)len);
+  write_string(snapshot, str, len);
+
+  return ++snapshot->n_nodes;
+}
+
+/// Return true iff the record at `offset` is a resource with string `str`
+static bool
+record_equals(const Snapshot* const snapshot,
+              const size_t          offset,
+              const SordNodeType    type,
+              const SerdNode* const str)
+{
+  const uint8_t* const record = snapshot->nodes + offset;
+  const uint32_t       len    = read_u32(record + 9U);
+
+  return record[0] == (uint8_t)type && !read_u32(record + 5U) &&
+         len == str->n_bytes && !memcmp(record + 13U, str->buf, len);
+}
+
+/**
+   Append a resource node (URI or blank) and return its index plus one.
+
+   If `last` is given, and refers to the same node, then it is reused instead
+   of appending a new record.  This avoids duplicating most subjects and
+   predicates, since Turtle tends to group statements about one subject.
+
+   @return The index of the node plus one, or zero on error.
+*/
+static uint32_t
+append_resource(SnapshotReader* const reader,
+                const SerdNode* const node,
+                NodeRef* const        last)
+{
+  Snapshot* const    snapshot = reader->snapshot;
+  const SordNodeType type = (node->type == SERD_BLANK) ? SORD_BLANK : SORD_URI;
+
+  // Expand URIs and CURIEs so that the record is independent of the env
+  SerdNode        expanded = SERD_NODE_NULL;
+  const SerdNode* str      = node;
+  if (type == SORD_URI) {
+    expanded = serd_env_expand_node(reader->env, node);
+    if (!expanded.buf) {
+      return 0U;
+    }
+
+    str = &expanded;
+  }
+
+  uint32_t i = 0U;
+  if (last && last->index && record_equals(snapshot, last->offset, type, str)) {
+    i = last->index;
+  } else {
+    const size_t offset = snapshot->nodes_size;
+
+    i = append_node(snapshot, type, str->buf, str->n_bytes, 0U, NULL, 0U);
+    if (last && i) {
+      last->index  = i;
+      last->offset = offset;
+    }
+  }
+
+  serd_node_free(&expanded);
+  return i;
+}
+
+static SerdStatus
+on_base(SnapshotReader* const reader, const SerdNode* const uri)
+{
+  return serd_env_set_base_uri(reader->env, uri);
+}
+
+static SerdStatus
+on_prefix(SnapshotReader* const reader,
+          const SerdNode* const name,
+          const SerdNode* const uri)
+{
+  return serd_env_set_prefix(reader->env, name, uri);
+}
+
+static SerdStatus
+on_statement(SnapshotReader* const    reader,
+             const SerdStatementFlags flags,
+             const SerdNode* const    graph,
+             const SerdNode* const    subject,
+             const SerdNode* const    predicate,
+             const SerdNode* const    object,
+             const SerdNode* const    object_datatype,
+             const SerdNode* const    object_lang)
+{
+  (void)flags;
+  (void)graph;
+
+  Snapshot* const snapshot = reader->snapshot;
+
+  const uint32_t s = append_resource(reader, subject, &reader->last_subject);
+  const uint32_t p =
+    append_resource(reader, predicate, &reader->last_predicate);
+
+  uint32_t o = 0U;
+  if (object->type == SERD_LITERAL) {
+    uint32_t datatype = 0U;
+    if (object_datatype && object_datatype->buf) {
+      if (!(datatype = append_resource(reader, object_datatype, NULL))) {
+        return SERD_ERR_BAD_ARG;
+      }
+    }
+
+    const bool has_lang = object_lang && object_lang->buf;
+
+    o = append_node(snapshot,
+                    SORD_LITERAL,
+                    object->buf,
+                    object->n_bytes,
+                    datatype,
+                    has_lang ? object_lang->buf : NULL,
+                    has_lang ? object_lang->n_bytes : 0U);
+  } else {
+    o = append_resource(reader, object, NULL);
+  }
+
+  if (!s || !p || !o) {
+    return SERD_ERR_BAD_ARG;
+  }
+
+  if (snapshot->n_statements == snapshot->capacity) {
+    const uint32_t new_capacity =
+      snapshot->capacity ? snapshot->capacity * 2U : 256U;
+
+    uint32_t* const new_statements = (uint32_t*)realloc(
+      snapshot->statements, 3U * sizeof(uint32_t) * new_capacity);
+    if (!new_statements) {
+      return SERD_ERR_INTERNAL;
+    }
+
+    snapshot->statements = new_statements;
+    snapshot->capacity   = new_capacity;
+  }
+
+  uint32_t* const statement =
+    snapshot->statements + (3U * (size_t)snapshot->n_statements);
+
+  statement[0] = s - 1U;
+  statement[1] = p - 1U;
+  statement[2] = o - 1U;
+  ++snapshot->n_statements;
+
+  return SERD_SUCCESS;
+}
+
+Snapshot*
+snapshot_new(void)
+{
+  return (Snapshot*)calloc(1, sizeof(Snapshot));
+}
+
+void
+snapshot_free(Snapshot* const snapshot)
+{
+  if (snapshot) {
+    free(snapshot->statements);
+    free(snapshot->nodes);
+    free(snapshot);
+  }
+}
+
+SerdStatus
+snapshot_read_file(Snapshot* const       snapshot,
+                   const SerdNode* const base,
+                   const uint8_t* const  uri,
+                   const bool            map)
+{
+  SnapshotReader reader = {snapshot, serd_env_new(base), {0U, 0U}, {0U, 0U}};
+
+  SerdReader* const serd_reader =
+    serd_reader_new(SERD_TURTLE,
+                    &reader,
+                    NULL,
+                    (SerdBaseSink)on_base,
+                    (SerdPrefixSink)on_prefix,
+                    (SerdStatementSink)on_statement,
+                    NULL);
+
+  snapshot->status = lilv_mapped_file_read(serd_reader, uri, map);
+
+  serd_reader_free(serd_reader);
+  serd_env_free(reader.env);
+  return snapshot->status;
+}
+
+bool
+snapshot_is_valid(const Snapshot* const snapshot)
+{
+  const uint8_t* const nodes  = snapshot->nodes;
+  const size_t         size   = snapshot->nodes_size;
+  size_t               offset = 0U;
+
+  for (uint32_t i = 0U; i < snapshot->n_nodes; ++i) {
+    if (size - offset < 13U) {
+      return false;
+    }
+
+    const uint8_t  type     = nodes[offset];
+    const uint32_t datatype = read_u32(nodes + offset + 1U);
+    const uint32_t lang_len = read_u32(nodes + offset + 5U);
+    if ((type != SORD_URI && type != SORD_BLANK && type != SORD_LITERAL) ||
+        datatype > i || size - offset - 9U < (size_t)lang_len + 4U ||
+        (lang_len && nodes[offset + 9U + lang_len - 1U])) {
+      return false;
+    }
+
+    offset += 9U + lang_len;
+
+    const uint32_t len = read_u32(nodes + offset);
+    if (size - offset - 4U < (size_t)len + 1U || nodes[offset + 4U + len]) {
+      return false;
+    }
+
+    offset += 4U + len + 1U;
+  }
+
+  if (offset != size) {
+    return false;
+  }
+
+  for (size_t i = 0U; i < 3U * (size_t)snapshot->n_statements; ++i) {
+    if (snapshot->statements[i] >= snapshot->n_nodes) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+SerdStatus
+snapshot_replay(const Snapshot* const snapshot,
+                LoadSkimmer* const    skimmer,
+                const SordNode* const graph,
+                const uint8_t* const  blank_prefix)
+{
+  SordWorld* const world = skimmer->world;
+  SordNode** const nodes =
+    (SordNode**)calloc(snapshot->n_nodes ? snapshot->n_nodes : 1U,
+                       sizeof(SordNode*));
+  if (!nodes) {
+    return SERD_ERR_INTERNAL;
+  }
+
+  // Intern every node in order, so datatypes are always already interned
+  const size_t prefix_len = strlen((const char*)blank_prefix);
+  char*        label      = NULL;
+  size_t       offset     = 0U;
+  SerdStatus   st         = SERD_SUCCESS;
+  for (uint32_t i = 0U; !st && i < snapshot->n_nodes; ++i) {
+    const uint8_t* const record   = snapshot->nodes + offset;
+    const uint32_t       datatype = read_u32(record + 1U);
+    const uint32_t       lang_len = read_u32(record + 5U);
+    const char* const lang = lang_len ? (const char*)record + 9U : NULL;
+    const uint8_t* const len_ptr = record + 9U + lang_len;
+    const uint32_t       len     = read_u32(len_ptr);
+    const uint8_t* const str     = len_ptr + 4U;
+
+    offset += 9U + lang_len + 4U + len + 1U;
+
+    if (record[0] == SORD_URI) {
+      nodes[i] = sord_new_uri(world, str);
+    } else if (record[0] == SORD_BLANK) {
+      char* const new_label = (char*)realloc(label, prefix_len + len + 1U);
+      if (!new_label) {
+        st = SERD_ERR_INTERNAL;
+        break;
+      }
+
+      label = new_label;
+      memcpy(label, blank_prefix, prefix_len);
+      memcpy(label + prefix_len, str, len + 1U);
+      nodes[i] = sord_new_blank(world, (const uint8_t*)label);
+    } else {
+      nodes[i] = sord_new_literal(
+        world, datatype ? nodes[datatype - 1U] : NULL, str, lang);
+    }
+
+    if (!nodes[i]) {
+      st = SERD_ERR_BAD_ARG;
+    }
+  }
+
+  // Skim and insert every statement
+  for (uint32_t i = 0U; !st && i < snapshot->n_statements; ++i) {
+    const uint32_t* const statement = snapshot->statements + (3U * i);
+
+    st = load_skimmer_add(skimmer,
+                          nodes[statement[0]],
+                          nodes[statement[1]],
+                          nodes[statement[2]],
+                          graph);
+  }
+
+  for (uint32_t i = 0U; i < snapshot->n_nodes; ++i) {
+    sord_node_free(world, nodes[i]);
+  }
+
+  free(label);
+  free(nodes);
+  return st ? st : snapshot->status;
+}
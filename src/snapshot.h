@@ -0,0 +1,87 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_SNAPSHOT_H
+#define LILV_SNAPSHOT_H
+
+#include "load_skimmer.h"
+
+#include <serd/serd.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+   A compact, world-independent copy of the statements read from a file.
+
+   Nodes are stored once each as packed records in a single buffer, and
+   statements are stored as triples of node indices.  URIs are stored fully
+   expanded, and blank node labels are stored without any prefix, so a
+   snapshot can be replayed into any world (or written to disk and read back)
+   with exactly the same result as parsing the original file again.
+*/
+typedef struct SnapshotImpl {
+  uint8_t* ZIX_ALLOCATED  nodes;          ///< Packed node records
+  size_t                  nodes_size;     ///< Size of node records in bytes
+  size_t                  nodes_capacity; ///< Allocated size of nodes
+  uint32_t                n_nodes;        ///< Number of node records
+  uint32_t* ZIX_ALLOCATED statements;     ///< Node indices, 3 per statement
+  uint32_t                n_statements;   ///< Number of statements
+  uint32_t                capacity;       ///< Allocated number of statements
+  SerdStatus              status;         ///< Status of reading the source
+} Snapshot;
+
+/// Return a new empty snapshot
+Snapshot* ZIX_ALLOCATED
+snapshot_new(void);
+
+/// Free a snapshot
+void
+snapshot_free(Snapshot* ZIX_NULLABLE snapshot);
+
+/**
+   Read a Turtle file into an empty snapshot.
+
+   @param snapshot Snapshot to append statements to.
+   @param base Base URI for resolving relative references.
+   @param uri File URI of the input.
+   @param map If true, map the file into memory to read it if possible.
+   @return The status of reading, which is also stored in the snapshot.
+*/
+SerdStatus
+snapshot_read_file(Snapshot* ZIX_NONNULL       snapshot,
+                   const SerdNode* ZIX_NONNULL base,
+                   const uint8_t* ZIX_NONNULL  uri,
+                   bool                        map);
+
+/**
+   Check that a snapshot is internally consistent.
+
+   This is used for snapshots that were read from disk, to ensure that
+   replaying them can't read out of bounds.
+*/
+bool
+snapshot_is_valid(const Snapshot* ZIX_NONNULL snapshot);
+
+/**
+   Replay the statements in a snapshot through a load skimmer.
+
+   Each statement is interned, skimmed, and inserted into the skimmer's model
+   just as if it was read from the original source.
+
+   @param snapshot Snapshot to replay.
+   @param skimmer Skimmer to pass statements to.
+   @param graph Graph to add statements to, or null.
+   @param blank_prefix Prefix to add to blank node labels.
+   @return The status of the original read, or an error from replaying.
+*/
+SerdStatus
+snapshot_replay(const Snapshot* ZIX_NONNULL  snapshot,
+                LoadSkimmer* ZIX_NONNULL     skimmer,
+                const SordNode* ZIX_NULLABLE graph,
+                const uint8_t* ZIX_NONNULL   blank_prefix);
+
+#endif // LILV_SNAPSHOT_H
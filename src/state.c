@@ -1487,6 +1487,7 @@ lilv_state_delete(LilvWorld* world, const LilvState* state)
     // Remove any existing manifest entries for this state
     const char* state_uri_str = lilv_node_as_string(state->uri);
     remove_manifest_entry(world->world, world->model, state_uri_str);
+    ++world->generation;
   }
 
   lilv_node_hash_free(see_also, world->world);
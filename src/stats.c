@@ -0,0 +1,101 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+typedef struct StatsRecordImpl StatsRecord;
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE StatsRecord
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "stats.h"
+
+#include "node_hash.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/// The statistics for a bundle or file
+struct StatsRecordImpl {
+  SordNode*     uri;   ///< Bundle or file URI
+  LilvLoadStats stats; ///< Accumulated statistics
+};
+
+ZIX_PURE_FUNC static const SordNode*
+record_uri(const StatsRecord* const record)
+{
+  return record->uri;
+}
+
+StatsHash*
+lilv_stats_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, record_uri, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_stats_hash_free(StatsHash* const hash, SordWorld* const world)
+{
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      StatsRecord* const record = zix_hash_get(hash, i);
+      sord_node_free(world, record->uri);
+      free(record);
+    }
+  }
+
+  zix_hash_free(hash);
+}
+
+LilvLoadStats*
+lilv_stats_hash_find(const StatsHash* const hash, const SordNode* const uri)
+{
+  StatsRecord* const record = zix_hash_find_record(hash, uri);
+
+  return record ? &record->stats : NULL;
+}
+
+LilvLoadStats*
+lilv_stats_hash_insert(StatsHash* const hash, const SordNode* const uri)
+{
+  const ZixHashInsertPlan plan   = zix_hash_plan_insert(hash, uri);
+  StatsRecord*            record = zix_hash_record_at(hash, plan);
+  if (!record && (record = (StatsRecord*)calloc(1, sizeof(StatsRecord)))) {
+    record->uri = sord_node_copy(uri);
+    if (zix_hash_insert_at(hash, plan, record)) {
+      free(record);
+      return NULL;
+    }
+  }
+
+  return record ? &record->stats : NULL;
+}
+
+void
+lilv_stats_hash_visit(const StatsHash* const hash,
+                      const StatsHashFunc    func,
+                      void* const            handle)
+{
+  for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+       i             = zix_hash_next(hash, i)) {
+    const StatsRecord* const record = zix_hash_get(hash, i);
+    func(handle, record->uri, &record->stats);
+  }
+}
+
+void
+lilv_load_stats_add(LilvLoadStats* const dst, const LilvLoadStats* const src)
+{
+  dst->n_files += src->n_files;
+  dst->n_bytes += src->n_bytes;
+  dst->n_statements += src->n_statements;
+  dst->parse_time += src->parse_time;
+  dst->version_time += src->version_time;
+  dst->dyn_manifest_time += src->dyn_manifest_time;
+}
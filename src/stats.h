@@ -0,0 +1,51 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_STATS_H
+#define LILV_STATS_H
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+#include <stddef.h>
+
+/// A hash of load statistics keyed by interned bundle or file URI
+typedef struct ZixHashImpl StatsHash;
+
+/// Function for visiting the statistics in a hash
+typedef void (*StatsHashFunc)(void* ZIX_UNSPECIFIED            handle,
+                              const SordNode* ZIX_NONNULL      uri,
+                              const LilvLoadStats* ZIX_NONNULL stats);
+
+/// Return a new empty stats hash
+StatsHash* ZIX_ALLOCATED
+lilv_stats_hash_new(void);
+
+/// Free a stats hash and all the records in it
+void
+lilv_stats_hash_free(StatsHash* ZIX_NULLABLE hash,
+                     SordWorld* ZIX_NONNULL  world);
+
+/// Return the statistics for a URI, or null
+LilvLoadStats* ZIX_NULLABLE
+lilv_stats_hash_find(const StatsHash* ZIX_NONNULL hash,
+                     const SordNode* ZIX_NONNULL  uri);
+
+/// Return the statistics for a URI, adding new zero statistics if necessary
+LilvLoadStats* ZIX_NULLABLE
+lilv_stats_hash_insert(StatsHash* ZIX_NONNULL      hash,
+                       const SordNode* ZIX_NONNULL uri);
+
+/// Call `func` with the statistics of every URI in a hash
+void
+lilv_stats_hash_visit(const StatsHash* ZIX_NONNULL hash,
+                      StatsHashFunc ZIX_NONNULL    func,
+                      void* ZIX_UNSPECIFIED        handle);
+
+/// Add the statistics in `src` to `dst`
+void
+lilv_load_stats_add(LilvLoadStats* ZIX_NONNULL       dst,
+                    const LilvLoadStats* ZIX_NONNULL src);
+
+#endif // LILV_STATS_H
@@ -12,7 +12,13 @@
 
 #include <sys/stat.h>
 
+#ifdef _WIN32
+#  include <windows.h>
+#endif
+
 #include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -124,3 +130,47 @@ lilv_get_latest_copy(const char* path, const char* copy_path)
   zix_free(NULL, copy_dir);
   return latest.latest;
 }
+
+int
+lilv_file_stamp(const char* const path, LilvFileStamp* const stamp)
+{
+  struct stat st;
+  if (stat(path, &st)) {
+    return errno;
+  }
+
+#if defined(_WIN32)
+  const int64_t nsec = 0;
+#elif defined(__APPLE__)
+  const int64_t nsec = (int64_t)st.st_mtimespec.tv_nsec;
+#else
+  const int64_t nsec = (int64_t)st.st_mtim.tv_nsec;
+#endif
+
+  stamp->mtime = ((int64_t)st.st_mtime * 1000000000) + nsec;
+  stamp->size  = (uint64_t)st.st_size;
+  return 0;
+}
+
+bool
+lilv_file_stamp_equals(const LilvFileStamp* const lhs,
+                       const LilvFileStamp* const rhs)
+{
+  return lhs->mtime == rhs->mtime && lhs->size == rhs->size;
+}
+
+uint64_t
+lilv_time_ns(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER count;
+  LARGE_INTEGER frequency;
+  QueryPerformanceCounter(&count);
+  QueryPerformanceFrequency(&frequency);
+  return (uint64_t)((double)count.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+  struct timespec now = {0, 0};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+#endif
+}
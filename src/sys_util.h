@@ -7,10 +7,17 @@
 #include <zix/attributes.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef bool (*LilvPathExistsFunc)(const char* ZIX_NONNULL     path,
                                    const void* ZIX_UNSPECIFIED handle);
 
+/// The modification time and size of a file, used to detect changes
+typedef struct {
+  int64_t  mtime; ///< Modification time in nanoseconds since the epoch
+  uint64_t size;  ///< Size in bytes
+} LilvFileStamp;
+
 /// Get the normalized LANG from the environment
 char* ZIX_UNSPECIFIED
 lilv_get_lang(void);
@@ -30,4 +37,17 @@ char* ZIX_UNSPECIFIED
 lilv_get_latest_copy(const char* ZIX_NONNULL path,
                      const char* ZIX_NONNULL copy_path);
 
+/// Get the current stamp of the file at `path`, return non-zero on error
+int
+lilv_file_stamp(const char* ZIX_NONNULL path, LilvFileStamp* ZIX_NONNULL stamp);
+
+/// Return true iff two file stamps are equal
+bool
+lilv_file_stamp_equals(const LilvFileStamp* ZIX_NONNULL lhs,
+                       const LilvFileStamp* ZIX_NONNULL rhs);
+
+/// Return the current time of a monotonic clock in nanoseconds
+uint64_t
+lilv_time_ns(void);
+
 #endif /* LILV_SYS_UTIL_H */
@@ -4,13 +4,16 @@
 #include "type_skimmer.h"
 
 #include "node_hash.h"
+#include "versions.h"
 
 #include <serd/serd.h>
 #include <sord/sord.h>
 #include <zix/allocator.h>
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdlib.h>
 
 static bool
 node_equals(const SordNode* const lhs, const SordNode* const rhs)
@@ -37,6 +40,37 @@ add_statement(SordModel* const model, const SordQuad tup)
   sord_add(model, tup);
 }
 
+static int
+int_from_node(const SordNode* const node)
+{
+  if (sord_node_get_type(node) == SORD_LITERAL) {
+    const char* const str   = (const char*)sord_node_get_string(node);
+    const long        value = strtol(str, NULL, 10);
+    if (value >= 0 && value < INT_MAX) {
+      return (int)value;
+    }
+  }
+  return 0;
+}
+
+static void
+add_version(TypeSkimmer* const    skimmer,
+            const SordNode* const subject,
+            const SordNode* const predicate,
+            const SordNode* const object)
+{
+  LilvVersion* const version =
+    lilv_version_hash_insert(skimmer->versions, skimmer->bundle, subject);
+
+  if (version) {
+    if (node_equals(predicate, skimmer->uris->lv2_minorVersion)) {
+      version->minor = int_from_node(object);
+    } else {
+      version->micro = int_from_node(object);
+    }
+  }
+}
+
 static SerdStatus
 skim_type(TypeSkimmer* const    skimmer,
           const SordNode* const subject,
@@ -63,6 +97,10 @@ skim_type(TypeSkimmer* const    skimmer,
              node_equals(predicate, skimmer->uris->rdfs_subClassOf)) {
     const SordQuad tup = {subject, predicate, object, NULL};
     add_statement(skimmer->subclasses, tup);
+  } else if (skimmer->versions &&
+             (node_equals(predicate, skimmer->uris->lv2_minorVersion) ||
+              node_equals(predicate, skimmer->uris->lv2_microVersion))) {
+    add_version(skimmer, subject, predicate, object);
   }
 
   return SERD_SUCCESS;
@@ -95,6 +133,8 @@ type_skimmer_new(SordWorld* const      world,
     skimmer->replaced     = replaced;
     skimmer->applications = applications;
     skimmer->subclasses   = subclasses;
+    skimmer->versions     = NULL;
+    skimmer->bundle       = NULL;
   }
 
   return skimmer;
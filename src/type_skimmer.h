@@ -7,6 +7,7 @@
 #include "load_skimmer.h"
 #include "node_hash.h"
 #include "uris.h"
+#include "versions.h"
 
 #include <serd/serd.h>
 #include <sord/sord.h>
@@ -22,6 +23,8 @@ typedef struct TypeSkimmerImpl {
   NodeHash* ZIX_NULLABLE* ZIX_NULLABLE replaced;
   SordModel* ZIX_NULLABLE              applications;
   SordModel* ZIX_NULLABLE              subclasses;
+  VersionHash* ZIX_NULLABLE            versions;
+  const SordNode* ZIX_NULLABLE         bundle;
 } TypeSkimmer;
 
 TypeSkimmer* ZIX_ALLOCATED
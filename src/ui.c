@@ -6,7 +6,6 @@
 
 #include <lilv/lilv.h>
 #include <sord/sord.h>
-#include <zix/tree.h>
 
 #include <assert.h>
 #include <stdbool.h>
@@ -36,8 +35,8 @@ lilv_ui_new(LilvWorld* const      world,
   free(bundle);
 
   ui->classes = lilv_nodes_new();
-  zix_tree_insert(
-    (ZixTree*)ui->classes, lilv_node_new_from_node(world, type_uri), NULL);
+  lilv_collection_insert(ui->classes,
+                         lilv_node_new_from_node(world, type_uri));
 
   return ui;
 }
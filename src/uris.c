@@ -6,6 +6,7 @@
 #include <lv2/atom/atom.h>
 #include <lv2/core/lv2.h>
 #include <lv2/event/event.h>
+#include <lv2/port-props/port-props.h>
 #include <lv2/presets/presets.h>
 #include <lv2/state/state.h>
 #include <lv2/ui/ui.h>
@@ -28,57 +29,80 @@ lilv_uris_init(LilvURIs* const uris, SordWorld* const world)
 {
 #define NEW_URI(uri) sord_new_uri(world, (const uint8_t*)(uri))
 
-  uris->atom_supports       = NEW_URI(LV2_ATOM__supports);
-  uris->dc_replaces         = NEW_URI(NS_DCTERMS "replaces");
-  uris->dman_DynManifest    = NEW_URI(NS_DYNMAN "DynManifest");
-  uris->doap_maintainer     = NEW_URI(NS_DOAP "maintainer");
-  uris->doap_name           = NEW_URI(NS_DOAP "name");
-  uris->event_supportsEvent = NEW_URI(LV2_EVENT__supportsEvent);
-  uris->foaf_homepage       = NEW_URI(NS_FOAF "homepage");
-  uris->foaf_mbox           = NEW_URI(NS_FOAF "mbox");
-  uris->foaf_name           = NEW_URI(NS_FOAF "name");
-  uris->lv2_Plugin          = NEW_URI(LV2_CORE__Plugin);
-  uris->lv2_Specification   = NEW_URI(LV2_CORE__Specification);
-  uris->lv2_appliesTo       = NEW_URI(LV2_CORE__appliesTo);
-  uris->lv2_binary          = NEW_URI(LV2_CORE__binary);
-  uris->lv2_default         = NEW_URI(LV2_CORE__default);
-  uris->lv2_designation     = NEW_URI(LV2_CORE__designation);
-  uris->lv2_extensionData   = NEW_URI(LV2_CORE__extensionData);
-  uris->lv2_index           = NEW_URI(LV2_CORE__index);
-  uris->lv2_latency         = NEW_URI(LV2_CORE__latency);
-  uris->lv2_maximum         = NEW_URI(LV2_CORE__maximum);
-  uris->lv2_microVersion    = NEW_URI(LV2_CORE__microVersion);
-  uris->lv2_minimum         = NEW_URI(LV2_CORE__minimum);
-  uris->lv2_minorVersion    = NEW_URI(LV2_CORE__minorVersion);
-  uris->lv2_name            = NEW_URI(LV2_CORE__name);
-  uris->lv2_optionalFeature = NEW_URI(LV2_CORE__optionalFeature);
-  uris->lv2_port            = NEW_URI(LV2_CORE__port);
-  uris->lv2_portProperty    = NEW_URI(LV2_CORE__portProperty);
-  uris->lv2_project         = NEW_URI(LV2_CORE__project);
-  uris->lv2_prototype       = NEW_URI(LV2_CORE__prototype);
-  uris->lv2_reportsLatency  = NEW_URI(LV2_CORE__reportsLatency);
-  uris->lv2_requiredFeature = NEW_URI(LV2_CORE__requiredFeature);
-  uris->lv2_scalePoint      = NEW_URI(LV2_CORE__scalePoint);
-  uris->lv2_symbol          = NEW_URI(LV2_CORE__symbol);
-  uris->owl_Ontology        = NEW_URI(NS_OWL "Ontology");
-  uris->pset_Preset         = NEW_URI(LV2_PRESETS__Preset);
-  uris->pset_value          = NEW_URI(LV2_PRESETS__value);
-  uris->rdf_type            = NEW_URI(NS_RDF "type");
-  uris->rdf_value           = NEW_URI(NS_RDF "value");
-  uris->rdfs_Class          = NEW_URI(NS_RDFS "Class");
-  uris->rdfs_label          = NEW_URI(NS_RDFS "label");
-  uris->rdfs_seeAlso        = NEW_URI(NS_RDFS "seeAlso");
-  uris->rdfs_subClassOf     = NEW_URI(NS_RDFS "subClassOf");
-  uris->state_state         = NEW_URI(LV2_STATE__state);
-  uris->ui_binary           = NEW_URI(LV2_UI__binary);
-  uris->ui_ui               = NEW_URI(LV2_UI__ui);
-  uris->xsd_base64Binary    = NEW_URI(NS_XSD "base64Binary");
-  uris->xsd_boolean         = NEW_URI(NS_XSD "boolean");
-  uris->xsd_decimal         = NEW_URI(NS_XSD "decimal");
-  uris->xsd_double          = NEW_URI(NS_XSD "double");
-  uris->xsd_float           = NEW_URI(NS_XSD "float");
-  uris->xsd_integer         = NEW_URI(NS_XSD "integer");
-  uris->terminator          = NULL;
+  uris->atom_AtomPort          = NEW_URI(LV2_ATOM__AtomPort);
+  uris->atom_bufferType        = NEW_URI(LV2_ATOM__bufferType);
+  uris->atom_supports          = NEW_URI(LV2_ATOM__supports);
+  uris->dc_replaces            = NEW_URI(NS_DCTERMS "replaces");
+  uris->dman_DynManifest       = NEW_URI(NS_DYNMAN "DynManifest");
+  uris->doap_maintainer        = NEW_URI(NS_DOAP "maintainer");
+  uris->doap_name              = NEW_URI(NS_DOAP "name");
+  uris->event_EventPort        = NEW_URI(LV2_EVENT__EventPort);
+  uris->event_supportsEvent    = NEW_URI(LV2_EVENT__supportsEvent);
+  uris->foaf_homepage          = NEW_URI(NS_FOAF "homepage");
+  uris->foaf_mbox              = NEW_URI(NS_FOAF "mbox");
+  uris->foaf_name              = NEW_URI(NS_FOAF "name");
+  uris->lv2_AudioPort          = NEW_URI(LV2_CORE__AudioPort);
+  uris->lv2_CVPort             = NEW_URI(LV2_CORE__CVPort);
+  uris->lv2_ControlPort        = NEW_URI(LV2_CORE__ControlPort);
+  uris->lv2_InputPort          = NEW_URI(LV2_CORE__InputPort);
+  uris->lv2_OutputPort         = NEW_URI(LV2_CORE__OutputPort);
+  uris->lv2_Plugin             = NEW_URI(LV2_CORE__Plugin);
+  uris->lv2_Specification      = NEW_URI(LV2_CORE__Specification);
+  uris->lv2_appliesTo          = NEW_URI(LV2_CORE__appliesTo);
+  uris->lv2_binary             = NEW_URI(LV2_CORE__binary);
+  uris->lv2_connectionOptional = NEW_URI(LV2_CORE__connectionOptional);
+  uris->lv2_default            = NEW_URI(LV2_CORE__default);
+  uris->lv2_designation        = NEW_URI(LV2_CORE__designation);
+  uris->lv2_enumeration        = NEW_URI(LV2_CORE__enumeration);
+  uris->lv2_extensionData      = NEW_URI(LV2_CORE__extensionData);
+  uris->lv2_index              = NEW_URI(LV2_CORE__index);
+  uris->lv2_integer            = NEW_URI(LV2_CORE__integer);
+  uris->lv2_isSideChain        = NEW_URI(LV2_CORE__isSideChain);
+  uris->lv2_latency            = NEW_URI(LV2_CORE__latency);
+  uris->lv2_maximum            = NEW_URI(LV2_CORE__maximum);
+  uris->lv2_microVersion       = NEW_URI(LV2_CORE__microVersion);
+  uris->lv2_minimum            = NEW_URI(LV2_CORE__minimum);
+  uris->lv2_minorVersion       = NEW_URI(LV2_CORE__minorVersion);
+  uris->lv2_name               = NEW_URI(LV2_CORE__name);
+  uris->lv2_optionalFeature    = NEW_URI(LV2_CORE__optionalFeature);
+  uris->lv2_port               = NEW_URI(LV2_CORE__port);
+  uris->lv2_portProperty       = NEW_URI(LV2_CORE__portProperty);
+  uris->lv2_project            = NEW_URI(LV2_CORE__project);
+  uris->lv2_prototype          = NEW_URI(LV2_CORE__prototype);
+  uris->lv2_reportsLatency     = NEW_URI(LV2_CORE__reportsLatency);
+  uris->lv2_requiredFeature    = NEW_URI(LV2_CORE__requiredFeature);
+  uris->lv2_sampleRate         = NEW_URI(LV2_CORE__sampleRate);
+  uris->lv2_scalePoint         = NEW_URI(LV2_CORE__scalePoint);
+  uris->lv2_symbol             = NEW_URI(LV2_CORE__symbol);
+  uris->lv2_toggled            = NEW_URI(LV2_CORE__toggled);
+  uris->owl_Ontology           = NEW_URI(NS_OWL "Ontology");
+  uris->pprops_causesArtifacts = NEW_URI(LV2_PORT_PROPS__causesArtifacts);
+  uris->pprops_continuousCV    = NEW_URI(LV2_PORT_PROPS__continuousCV);
+  uris->pprops_discreteCV      = NEW_URI(LV2_PORT_PROPS__discreteCV);
+  uris->pprops_expensive       = NEW_URI(LV2_PORT_PROPS__expensive);
+  uris->pprops_hasStrictBounds = NEW_URI(LV2_PORT_PROPS__hasStrictBounds);
+  uris->pprops_logarithmic     = NEW_URI(LV2_PORT_PROPS__logarithmic);
+  uris->pprops_notAutomatic    = NEW_URI(LV2_PORT_PROPS__notAutomatic);
+  uris->pprops_notOnGUI        = NEW_URI(LV2_PORT_PROPS__notOnGUI);
+  uris->pprops_trigger         = NEW_URI(LV2_PORT_PROPS__trigger);
+  uris->pset_Preset            = NEW_URI(LV2_PRESETS__Preset);
+  uris->pset_value             = NEW_URI(LV2_PRESETS__value);
+  uris->rdf_type               = NEW_URI(NS_RDF "type");
+  uris->rdf_value              = NEW_URI(NS_RDF "value");
+  uris->rdfs_Class             = NEW_URI(NS_RDFS "Class");
+  uris->rdfs_label             = NEW_URI(NS_RDFS "label");
+  uris->rdfs_seeAlso           = NEW_URI(NS_RDFS "seeAlso");
+  uris->rdfs_subClassOf        = NEW_URI(NS_RDFS "subClassOf");
+  uris->state_state            = NEW_URI(LV2_STATE__state);
+  uris->ui_binary              = NEW_URI(LV2_UI__binary);
+  uris->ui_ui                  = NEW_URI(LV2_UI__ui);
+  uris->xsd_base64Binary       = NEW_URI(NS_XSD "base64Binary");
+  uris->xsd_boolean            = NEW_URI(NS_XSD "boolean");
+  uris->xsd_decimal            = NEW_URI(NS_XSD "decimal");
+  uris->xsd_double             = NEW_URI(NS_XSD "double");
+  uris->xsd_float              = NEW_URI(NS_XSD "float");
+  uris->xsd_integer            = NEW_URI(NS_XSD "integer");
+  uris->terminator             = NULL;
 }
 
 void
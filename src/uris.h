@@ -8,23 +8,35 @@
 #include <zix/attributes.h>
 
 typedef struct {
+  SordNode* ZIX_ALLOCATED atom_AtomPort;
+  SordNode* ZIX_ALLOCATED atom_bufferType;
   SordNode* ZIX_ALLOCATED atom_supports;
   SordNode* ZIX_ALLOCATED dc_replaces;
   SordNode* ZIX_ALLOCATED dman_DynManifest;
   SordNode* ZIX_ALLOCATED doap_maintainer;
   SordNode* ZIX_ALLOCATED doap_name;
+  SordNode* ZIX_ALLOCATED event_EventPort;
   SordNode* ZIX_ALLOCATED event_supportsEvent;
   SordNode* ZIX_ALLOCATED foaf_homepage;
   SordNode* ZIX_ALLOCATED foaf_mbox;
   SordNode* ZIX_ALLOCATED foaf_name;
+  SordNode* ZIX_ALLOCATED lv2_AudioPort;
+  SordNode* ZIX_ALLOCATED lv2_CVPort;
+  SordNode* ZIX_ALLOCATED lv2_ControlPort;
+  SordNode* ZIX_ALLOCATED lv2_InputPort;
+  SordNode* ZIX_ALLOCATED lv2_OutputPort;
   SordNode* ZIX_ALLOCATED lv2_Plugin;
   SordNode* ZIX_ALLOCATED lv2_Specification;
   SordNode* ZIX_ALLOCATED lv2_appliesTo;
   SordNode* ZIX_ALLOCATED lv2_binary;
+  SordNode* ZIX_ALLOCATED lv2_connectionOptional;
   SordNode* ZIX_ALLOCATED lv2_default;
   SordNode* ZIX_ALLOCATED lv2_designation;
+  SordNode* ZIX_ALLOCATED lv2_enumeration;
   SordNode* ZIX_ALLOCATED lv2_extensionData;
   SordNode* ZIX_ALLOCATED lv2_index;
+  SordNode* ZIX_ALLOCATED lv2_integer;
+  SordNode* ZIX_ALLOCATED lv2_isSideChain;
   SordNode* ZIX_ALLOCATED lv2_latency;
   SordNode* ZIX_ALLOCATED lv2_maximum;
   SordNode* ZIX_ALLOCATED lv2_microVersion;
@@ -38,9 +50,20 @@ typedef struct {
   SordNode* ZIX_ALLOCATED lv2_prototype;
   SordNode* ZIX_ALLOCATED lv2_reportsLatency;
   SordNode* ZIX_ALLOCATED lv2_requiredFeature;
+  SordNode* ZIX_ALLOCATED lv2_sampleRate;
   SordNode* ZIX_ALLOCATED lv2_scalePoint;
   SordNode* ZIX_ALLOCATED lv2_symbol;
+  SordNode* ZIX_ALLOCATED lv2_toggled;
   SordNode* ZIX_ALLOCATED owl_Ontology;
+  SordNode* ZIX_ALLOCATED pprops_causesArtifacts;
+  SordNode* ZIX_ALLOCATED pprops_continuousCV;
+  SordNode* ZIX_ALLOCATED pprops_discreteCV;
+  SordNode* ZIX_ALLOCATED pprops_expensive;
+  SordNode* ZIX_ALLOCATED pprops_hasStrictBounds;
+  SordNode* ZIX_ALLOCATED pprops_logarithmic;
+  SordNode* ZIX_ALLOCATED pprops_notAutomatic;
+  SordNode* ZIX_ALLOCATED pprops_notOnGUI;
+  SordNode* ZIX_ALLOCATED pprops_trigger;
   SordNode* ZIX_ALLOCATED pset_Preset;
   SordNode* ZIX_ALLOCATED pset_value;
   SordNode* ZIX_ALLOCATED rdf_type;
@@ -0,0 +1,83 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#define ZIX_HASH_KEY_TYPE LilvNode
+#define ZIX_HASH_RECORD_TYPE LilvNode
+#define ZIX_HASH_SEARCH_DATA_TYPE LilvNode
+
+#include "value_hash.h"
+
+#include "lilv_internal.h"
+
+#include <lilv/lilv.h>
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/digest.h>
+#include <zix/hash.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+ZIX_PURE_FUNC static const LilvNode*
+value_key(const LilvNode* const node)
+{
+  return node;
+}
+
+ZIX_PURE_FUNC static size_t
+value_hash(const LilvNode* const node)
+{
+  const size_t seed = (size_t)node->type;
+
+  switch (node->type) {
+  case LILV_VALUE_URI:
+  case LILV_VALUE_BLANK:
+  case LILV_VALUE_STRING:
+  case LILV_VALUE_BLOB:
+    // Resources and strings are equal only if their interned nodes are
+    return zix_digest_aligned(seed, &node->node, sizeof(SordNode*));
+  case LILV_VALUE_INT:
+    return zix_digest(seed, &node->val.int_val, sizeof(int));
+  case LILV_VALUE_FLOAT:
+    if (node->val.float_val == 0.0f) {
+      return seed; // Positive and negative zero are equal
+    }
+    return zix_digest(seed, &node->val.float_val, sizeof(float));
+  case LILV_VALUE_BOOL:
+    return seed + (node->val.bool_val ? 1U : 0U);
+  }
+
+  return seed;
+}
+
+static bool
+value_equal(const LilvNode* const lhs, const LilvNode* const rhs)
+{
+  return lilv_node_equals(lhs, rhs);
+}
+
+ValueHash*
+lilv_value_hash_new(void)
+{
+  return zix_hash_new(NULL, value_key, value_hash, value_equal);
+}
+
+void
+lilv_value_hash_free(ValueHash* const hash)
+{
+  zix_hash_free(hash);
+}
+
+ZixStatus
+lilv_value_hash_insert(ValueHash* const hash, const LilvNode* const node)
+{
+  return zix_hash_insert(hash, (LilvNode*)node);
+}
+
+bool
+lilv_value_hash_contains(const ValueHash* const hash,
+                         const LilvNode* const  value)
+{
+  return zix_hash_find_record(hash, value) != NULL;
+}
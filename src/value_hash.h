@@ -0,0 +1,34 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_VALUE_HASH_H
+#define LILV_VALUE_HASH_H
+
+#include <lilv/lilv.h>
+#include <zix/attributes.h>
+#include <zix/status.h>
+
+#include <stdbool.h>
+
+/// A hash of nodes compared like lilv_node_equals(), which doesn't own them
+typedef struct ZixHashImpl ValueHash;
+
+/// Return a new empty value hash
+ValueHash* ZIX_ALLOCATED
+lilv_value_hash_new(void);
+
+/// Free a value hash (but not the nodes in it)
+void
+lilv_value_hash_free(ValueHash* ZIX_NULLABLE hash);
+
+/// Add a node to the hash, if no equal node is already present
+ZixStatus
+lilv_value_hash_insert(ValueHash* ZIX_NONNULL      hash,
+                       const LilvNode* ZIX_NONNULL node);
+
+/// Return whether the hash contains a node equal to `value`
+bool
+lilv_value_hash_contains(const ValueHash* ZIX_NONNULL hash,
+                         const LilvNode* ZIX_NONNULL  value);
+
+#endif // LILV_VALUE_HASH_H
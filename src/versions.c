@@ -0,0 +1,145 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+typedef struct VersionRecordImpl VersionRecord;
+
+#define ZIX_HASH_KEY_TYPE SordNode
+#define ZIX_HASH_RECORD_TYPE VersionRecord
+#define ZIX_HASH_SEARCH_DATA_TYPE SordNode
+
+#include "versions.h"
+
+#include "node_hash.h"
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+#include <zix/hash.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/// The version of a resource
+typedef struct {
+  SordNode*   resource; ///< Resource URI
+  LilvVersion version;  ///< Version of resource
+} ResourceVersion;
+
+/// The versions of all resources in a bundle (usually only a few)
+struct VersionRecordImpl {
+  SordNode*        bundle;     ///< Bundle URI
+  ResourceVersion* versions;   ///< Array of resource versions
+  size_t           n_versions; ///< Number of elements in versions
+};
+
+ZIX_PURE_FUNC static const SordNode*
+record_bundle(const VersionRecord* const record)
+{
+  return record->bundle;
+}
+
+static void
+record_free(VersionRecord* const record, SordWorld* const world)
+{
+  for (size_t i = 0U; i < record->n_versions; ++i) {
+    sord_node_free(world, record->versions[i].resource);
+  }
+
+  sord_node_free(world, record->bundle);
+  free(record->versions);
+  free(record);
+}
+
+VersionHash*
+lilv_version_hash_new(void)
+{
+  return zix_hash_new(
+    NULL, record_bundle, lilv_node_ptr_hash, lilv_node_ptr_equal);
+}
+
+void
+lilv_version_hash_free(VersionHash* const hash, SordWorld* const world)
+{
+  if (hash) {
+    for (ZixHashIter i = zix_hash_begin(hash); i != zix_hash_end(hash);
+         i             = zix_hash_next(hash, i)) {
+      record_free(zix_hash_get(hash, i), world);
+    }
+  }
+
+  zix_hash_free(hash);
+}
+
+const LilvVersion*
+lilv_version_hash_find(const VersionHash* const hash,
+                       const SordNode* const    bundle,
+                       const SordNode* const    resource)
+{
+  const VersionRecord* const record = zix_hash_find_record(hash, bundle);
+  if (record) {
+    for (size_t i = 0U; i < record->n_versions; ++i) {
+      if (record->versions[i].resource == resource) {
+        return &record->versions[i].version;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+LilvVersion*
+lilv_version_hash_insert(VersionHash* const    hash,
+                         const SordNode* const bundle,
+                         const SordNode* const resource)
+{
+  // Find or add the record for this bundle
+  const ZixHashInsertPlan plan   = zix_hash_plan_insert(hash, bundle);
+  VersionRecord*          record = zix_hash_record_at(hash, plan);
+  if (!record) {
+    if (!(record = (VersionRecord*)calloc(1, sizeof(VersionRecord)))) {
+      return NULL;
+    }
+
+    record->bundle = (SordNode*)bundle;
+    if (zix_hash_insert_at(hash, plan, record)) {
+      free(record);
+      return NULL;
+    }
+
+    sord_node_copy(bundle);
+  }
+
+  // Return the existing version of this resource if there is one
+  for (size_t i = 0U; i < record->n_versions; ++i) {
+    if (record->versions[i].resource == resource) {
+      return &record->versions[i].version;
+    }
+  }
+
+  // Append a new zero version for this resource
+  const size_t           n_versions = record->n_versions + 1U;
+  ResourceVersion* const versions   = (ResourceVersion*)realloc(
+    record->versions, n_versions * sizeof(ResourceVersion));
+  if (!versions) {
+    return NULL;
+  }
+
+  ResourceVersion* const entry = &versions[n_versions - 1U];
+  entry->resource              = sord_node_copy(resource);
+  entry->version.minor         = 0;
+  entry->version.micro         = 0;
+
+  record->versions   = versions;
+  record->n_versions = n_versions;
+  return &entry->version;
+}
+
+void
+lilv_version_hash_remove_bundle(VersionHash* const    hash,
+                                SordWorld* const      world,
+                                const SordNode* const bundle)
+{
+  VersionRecord* removed = NULL;
+  if (!zix_hash_remove(hash, bundle, &removed)) {
+    record_free(removed, world);
+  }
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_VERSIONS_H
+#define LILV_VERSIONS_H
+
+#include <sord/sord.h>
+#include <zix/attributes.h>
+
+/// The version of a resource, from lv2:minorVersion and lv2:microVersion
+typedef struct LilvVersion {
+  int minor;
+  int micro;
+} LilvVersion;
+
+/// A hash of resource versions keyed by interned (bundle, resource) pair
+typedef struct ZixHashImpl VersionHash;
+
+/// Return a new empty version hash
+VersionHash* ZIX_ALLOCATED
+lilv_version_hash_new(void);
+
+/// Free a version hash and all the records in it
+void
+lilv_version_hash_free(VersionHash* ZIX_NULLABLE hash,
+                       SordWorld* ZIX_NONNULL    world);
+
+/// Return the version of a resource in a bundle, or null
+const LilvVersion* ZIX_NULLABLE
+lilv_version_hash_find(const VersionHash* ZIX_NONNULL hash,
+                       const SordNode* ZIX_NONNULL    bundle,
+                       const SordNode* ZIX_NONNULL    resource);
+
+/// Return the version of a resource in a bundle, adding a zero version if new
+LilvVersion* ZIX_NULLABLE
+lilv_version_hash_insert(VersionHash* ZIX_NONNULL    hash,
+                         const SordNode* ZIX_NONNULL bundle,
+                         const SordNode* ZIX_NONNULL resource);
+
+/// Remove the versions of all resources in a bundle
+void
+lilv_version_hash_remove_bundle(VersionHash* ZIX_NONNULL    hash,
+                                SordWorld* ZIX_NONNULL      world,
+                                const SordNode* ZIX_NONNULL bundle);
+
+#endif // LILV_VERSIONS_H
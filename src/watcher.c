@@ -0,0 +1,240 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "watcher.h"
+
+#include "lilv_config.h"
+
+#include <zix/allocator.h>
+#include <zix/path.h>
+
+#if LILV_USE_INOTIFY
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if LILV_USE_INOTIFY
+
+#  define LILV_DIR_EVENTS \
+    (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)
+
+#  define LILV_BUNDLE_EVENTS                                              \
+    (IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | \
+     IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR)
+
+/// A watched directory
+typedef struct {
+  char* path;      ///< Directory path, or null if the watch was removed
+  bool  is_bundle; ///< True for a bundle, false for a path directory
+} Watch;
+
+struct WatcherImpl {
+  int    fd;        ///< Inotify instance
+  Watch* watches;   ///< Watches indexed by watch descriptor
+  size_t n_watches; ///< Size of watches array
+};
+
+Watcher*
+lilv_watcher_new(void)
+{
+  const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    return NULL;
+  }
+
+  Watcher* const watcher = (Watcher*)calloc(1, sizeof(Watcher));
+  if (!watcher) {
+    close(fd);
+    return NULL;
+  }
+
+  watcher->fd = fd;
+  return watcher;
+}
+
+void
+lilv_watcher_free(Watcher* const watcher)
+{
+  if (watcher) {
+    for (size_t i = 0U; i < watcher->n_watches; ++i) {
+      free(watcher->watches[i].path);
+    }
+
+    free(watcher->watches);
+    close(watcher->fd);
+    free(watcher);
+  }
+}
+
+int
+lilv_watcher_fd(const Watcher* const watcher)
+{
+  return watcher->fd;
+}
+
+static int
+lilv_watcher_add(Watcher* const    watcher,
+                 const char* const path,
+                 const bool        is_bundle)
+{
+  const int wd = inotify_add_watch(
+    watcher->fd, path, is_bundle ? LILV_BUNDLE_EVENTS : LILV_DIR_EVENTS);
+  if (wd < 0) {
+    return errno;
+  }
+
+  // Watch descriptors are small integers, so index them directly
+  const size_t index = (size_t)wd;
+  if (index >= watcher->n_watches) {
+    const size_t n_watches = index + 1U + (watcher->n_watches / 2U);
+    Watch* const watches =
+      (Watch*)realloc(watcher->watches, n_watches * sizeof(Watch));
+    if (!watches) {
+      inotify_rm_watch(watcher->fd, wd);
+      return ENOMEM;
+    }
+
+    memset(watches + watcher->n_watches,
+           0,
+           (n_watches - watcher->n_watches) * sizeof(Watch));
+
+    watcher->watches   = watches;
+    watcher->n_watches = n_watches;
+  }
+
+  // Adding an existing watch returns the same descriptor, so replace it
+  Watch* const watch = &watcher->watches[index];
+  const size_t len   = strlen(path);
+  free(watch->path);
+  if ((watch->path = (char*)malloc(len + 1U))) {
+    memcpy(watch->path, path, len + 1U);
+  }
+
+  watch->is_bundle = is_bundle;
+  return 0;
+}
+
+int
+lilv_watcher_add_dir(Watcher* const watcher, const char* const dir_path)
+{
+  return lilv_watcher_add(watcher, dir_path, false);
+}
+
+int
+lilv_watcher_add_bundle(Watcher* const watcher, const char* const bundle_path)
+{
+  return lilv_watcher_add(watcher, bundle_path, true);
+}
+
+static void
+lilv_watcher_handle(Watcher* const                    watcher,
+                    const struct inotify_event* const event,
+                    const WatcherFunc                 func,
+                    void* const                       handle)
+{
+  if (event->mask & IN_Q_OVERFLOW) {
+    func(handle, NULL);
+    return;
+  }
+
+  const size_t index = (size_t)event->wd;
+  if (event->wd < 0 || index >= watcher->n_watches ||
+      !watcher->watches[index].path) {
+    return;
+  }
+
+  Watch* const watch = &watcher->watches[index];
+  if (event->mask & IN_IGNORED) {
+    free(watch->path);
+    watch->path = NULL;
+  } else if (watch->is_bundle) {
+    func(handle, watch->path);
+  } else if (event->len && (event->mask & IN_ISDIR)) {
+    char* const path = zix_path_join(NULL, watch->path, event->name);
+    if (path) {
+      if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+        lilv_watcher_add(watcher, path, true);
+      }
+
+      func(handle, path);
+      zix_free(NULL, path);
+    }
+  }
+}
+
+void
+lilv_watcher_read(Watcher* const    watcher,
+                  const WatcherFunc func,
+                  void* const       handle)
+{
+  union {
+    struct inotify_event event;
+    char                 bytes[4096];
+  } buf;
+
+  ssize_t n_read = 0;
+  while ((n_read = read(watcher->fd, buf.bytes, sizeof(buf))) > 0) {
+    for (size_t offset = 0U; offset < (size_t)n_read;) {
+      const struct inotify_event* const event =
+        (const struct inotify_event*)(buf.bytes + offset);
+
+      lilv_watcher_handle(watcher, event, func, handle);
+      offset += sizeof(struct inotify_event) + event->len;
+    }
+  }
+}
+
+#else // !LILV_USE_INOTIFY
+
+Watcher*
+lilv_watcher_new(void)
+{
+  return NULL;
+}
+
+void
+lilv_watcher_free(Watcher* const watcher)
+{
+  (void)watcher;
+}
+
+int
+lilv_watcher_fd(const Watcher* const watcher)
+{
+  (void)watcher;
+  return -1;
+}
+
+int
+lilv_watcher_add_dir(Watcher* const watcher, const char* const dir_path)
+{
+  (void)watcher;
+  (void)dir_path;
+  return ENOSYS;
+}
+
+int
+lilv_watcher_add_bundle(Watcher* const watcher, const char* const bundle_path)
+{
+  (void)watcher;
+  (void)bundle_path;
+  return ENOSYS;
+}
+
+void
+lilv_watcher_read(Watcher* const    watcher,
+                  const WatcherFunc func,
+                  void* const       handle)
+{
+  (void)watcher;
+  (void)func;
+  (void)handle;
+}
+
+#endif // LILV_USE_INOTIFY
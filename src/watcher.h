@@ -0,0 +1,61 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef LILV_WATCHER_H
+#define LILV_WATCHER_H
+
+#include <zix/attributes.h>
+
+/**
+   A watcher for changes to bundles in the LV2 path.
+
+   This watches two kinds of directory: path directories, where only bundle
+   directories being added or removed are interesting, and bundle directories,
+   where any change to a file is interesting.  Bundle directories added to a
+   watched path directory are watched automatically.
+*/
+typedef struct WatcherImpl Watcher;
+
+/**
+   Function called for each changed bundle when reading events.
+
+   The path is the bundle directory path, or null if events have been lost so
+   anything could have changed.
+*/
+typedef void (*WatcherFunc)(void* ZIX_UNSPECIFIED    handle,
+                            const char* ZIX_NULLABLE bundle_path);
+
+/// Return a new watcher, or null if watching isn't supported
+Watcher* ZIX_ALLOCATED
+lilv_watcher_new(void);
+
+/// Free a watcher and stop watching everything
+void
+lilv_watcher_free(Watcher* ZIX_NULLABLE watcher);
+
+/// Return a file descriptor that becomes readable when events are pending
+int
+lilv_watcher_fd(const Watcher* ZIX_NONNULL watcher);
+
+/// Watch a directory in the LV2 path for bundles being added or removed
+int
+lilv_watcher_add_dir(Watcher* ZIX_NONNULL    watcher,
+                     const char* ZIX_NONNULL dir_path);
+
+/// Watch a bundle directory for any changes
+int
+lilv_watcher_add_bundle(Watcher* ZIX_NONNULL    watcher,
+                        const char* ZIX_NONNULL bundle_path);
+
+/**
+   Read all pending events without blocking.
+
+   The function is called for every bundle that an event affects, so it may be
+   called several times for the same bundle.
+*/
+void
+lilv_watcher_read(Watcher* ZIX_NONNULL    watcher,
+                  WatcherFunc ZIX_NONNULL func,
+                  void* ZIX_UNSPECIFIED   handle);
+
+#endif // LILV_WATCHER_H
@@ -1,16 +1,23 @@
 // Copyright 2007-2025 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "bundles.h"
+#include "cache.h"
 #include "lilv_config.h"
 #include "lilv_internal.h"
+#include "load_skimmer.h"
 #include "log.h"
+#include "mapped_file.h"
 #include "node_hash.h"
 #include "query.h"
+#include "snapshot.h"
+#include "stats.h"
 #include "string_util.h"
 #include "syntax_skimmer.h"
 #include "sys_util.h"
 #include "type_skimmer.h"
 #include "uris.h"
+#include "watcher.h"
 
 #ifdef LILV_DYN_MANIFEST
 #  include "dylib.h"
@@ -43,6 +50,12 @@ lilv_world_drop_graph(LilvWorld* world, const SordNode* graph);
 static int
 lilv_lib_compare(const void* a, const void* b, const void* user_data);
 
+static SerdStatus
+lilv_world_load_discovery_file(LilvWorld*      world,
+                               LoadSkimmer*    skimmer,
+                               const SordNode* graph,
+                               const SordNode* uri);
+
 LilvWorld*
 lilv_world_new(void)
 {
@@ -59,8 +72,14 @@ lilv_world_new(void)
   world->plugin_classes = lilv_plugin_classes_new();
   world->plugins        = lilv_plugins_new();
   world->zombies        = lilv_plugins_new();
+  world->plugin_index   = lilv_plugin_hash_new();
+  world->shared_nodes   = lilv_node_pool_new();
+  world->features       = lilv_feature_hash_new();
   world->loaded_files   = lilv_node_hash_new(NULL);
+  world->file_index     = lilv_file_index_new();
   world->replaced       = lilv_node_hash_new(NULL);
+  world->bundles        = lilv_bundle_hash_new();
+  world->versions       = lilv_version_hash_new();
 
   world->libs = zix_tree_new(NULL, false, lilv_lib_compare, NULL, NULL, NULL);
 
@@ -76,14 +95,41 @@ lilv_world_new(void)
     "Plugin");
   assert(world->lv2_plugin_class);
 
-  world->n_read_files     = 0;
-  world->opt.filter_lang  = true;
-  world->opt.dyn_manifest = true;
-  world->opt.object_index = true;
+  world->n_read_files          = 0;
+  world->opt.discovery_threads = 1U;
+  world->opt.filter_lang       = true;
+  world->opt.dyn_manifest      = true;
+  world->opt.object_index      = true;
 
   return world;
 }
 
+static void
+lilv_world_clear_class_index(LilvWorld* const world)
+{
+  ClassIndex* const index = &world->class_index;
+
+  free(index->classes);
+  free(index->children);
+  free(index->first_child);
+  free(index->ancestors);
+  index->classes     = NULL;
+  index->children    = NULL;
+  index->first_child = NULL;
+  index->ancestors   = NULL;
+  index->n_classes   = 0U;
+  index->n_words     = 0U;
+}
+
+static void
+lilv_spec_free(LilvWorld* const world, LilvSpec* const spec)
+{
+  sord_node_free(world->world, spec->spec);
+  sord_node_free(world->world, spec->bundle);
+  lilv_nodes_free(spec->data_uris);
+  free(spec);
+}
+
 void
 lilv_world_free(LilvWorld* world)
 {
@@ -101,26 +147,38 @@ lilv_world_free(LilvWorld* world)
 
   for (LilvSpec* spec = world->specs; spec;) {
     LilvSpec* next = spec->next;
-    sord_node_free(world->world, spec->spec);
-    sord_node_free(world->world, spec->bundle);
-    lilv_nodes_free(spec->data_uris);
-    free(spec);
+    lilv_spec_free(world, spec);
     spec = next;
   }
   world->specs = NULL;
 
+  lilv_plugin_hash_free(world->plugin_index);
+  world->plugin_index = NULL;
+
+  lilv_search_index_free(world->search_index);
+  world->search_index = NULL;
+
+  lilv_query_cache_free(world->query_cache, world->world);
+  world->query_cache = NULL;
+
+  lilv_node_pool_free(world->shared_nodes);
+  world->shared_nodes = NULL;
+
+  lilv_feature_hash_free(world->features, world->world);
+  world->features = NULL;
+
   LILV_FOREACH (plugins, i, world->plugins) {
     const LilvPlugin* p = lilv_plugins_get(world->plugins, i);
     lilv_plugin_free((LilvPlugin*)p);
   }
-  zix_tree_free((ZixTree*)world->plugins);
+  lilv_plugins_free(world->plugins);
   world->plugins = NULL;
 
   LILV_FOREACH (plugins, i, world->zombies) {
     const LilvPlugin* p = lilv_plugins_get(world->zombies, i);
     lilv_plugin_free((LilvPlugin*)p);
   }
-  zix_tree_free((ZixTree*)world->zombies);
+  lilv_plugins_free(world->zombies);
   world->zombies = NULL;
 
   lilv_node_hash_free(world->replaced, world->world);
@@ -129,18 +187,49 @@ lilv_world_free(LilvWorld* world)
   lilv_node_hash_free(world->loaded_files, world->world);
   world->loaded_files = NULL;
 
+  lilv_file_index_free(world->file_index, world->world);
+  world->file_index = NULL;
+
+  lilv_bundle_hash_free(world->bundles, world->world);
+  world->bundles = NULL;
+
+  lilv_version_hash_free(world->versions, world->world);
+  world->versions = NULL;
+
+  lilv_stats_hash_free(world->bundle_stats, world->world);
+  world->bundle_stats = NULL;
+
+  lilv_stats_hash_free(world->file_stats, world->world);
+  world->file_stats = NULL;
+
+  lilv_watcher_free(world->watcher);
+  world->watcher = NULL;
+
+  lilv_node_hash_free(world->changed_bundles, world->world);
+  world->changed_bundles = NULL;
+
+  free(world->change_queue);
+  world->change_queue     = NULL;
+  world->n_queued_changes = 0U;
+
   zix_tree_free(world->libs);
   world->libs = NULL;
 
-  zix_tree_free((ZixTree*)world->plugin_classes);
+  lilv_world_clear_class_index(world);
+
+  lilv_plugin_classes_free(world->plugin_classes);
   world->plugin_classes = NULL;
 
   sord_free(world->model);
   world->model = NULL;
 
+  lilv_cache_free(world->cache);
+  world->cache = NULL;
+
   sord_world_free(world->world);
   world->world = NULL;
 
+  free(world->opt.cache_dir);
   free(world->opt.lv2_path);
   free(world->lang);
   free(world);
@@ -149,7 +238,18 @@ lilv_world_free(LilvWorld* world)
 void
 lilv_world_set_option(LilvWorld* world, const char* uri, const LilvNode* value)
 {
-  if (!strcmp(uri, LILV_OPTION_DYN_MANIFEST)) {
+  if (!strcmp(uri, LILV_OPTION_CACHE_DIR)) {
+    if (lilv_node_is_string(value)) {
+      free(world->opt.cache_dir);
+      world->opt.cache_dir = lilv_strdup(lilv_node_as_string(value));
+      return;
+    }
+  } else if (!strcmp(uri, LILV_OPTION_DISCOVERY_THREADS)) {
+    if (lilv_node_is_int(value) && lilv_node_as_int(value) > 0) {
+      world->opt.discovery_threads = (unsigned)lilv_node_as_int(value);
+      return;
+    }
+  } else if (!strcmp(uri, LILV_OPTION_DYN_MANIFEST)) {
     if (!value || value->type == LILV_VALUE_BOOL) {
       world->opt.dyn_manifest = lilv_node_as_bool(value);
       return;
@@ -158,6 +258,7 @@ lilv_world_set_option(LilvWorld* world, const char* uri, const LilvNode* value)
     if (lilv_node_is_string(value)) {
       free(world->lang);
       world->lang = lilv_normalize_lang(lilv_node_as_string(value));
+      ++world->generation; // Invalidate cached results for the old language
       return;
     }
   } else if (!strcmp(uri, LILV_OPTION_FILTER_LANG)) {
@@ -165,17 +266,47 @@ lilv_world_set_option(LilvWorld* world, const char* uri, const LilvNode* value)
       world->opt.filter_lang = lilv_node_as_bool(value);
       return;
     }
+  } else if (!strcmp(uri, LILV_OPTION_LAZY_SPECIFICATIONS)) {
+    if (!value || value->type == LILV_VALUE_BOOL) {
+      world->opt.lazy_specs = lilv_node_as_bool(value);
+      return;
+    }
   } else if (!strcmp(uri, LILV_OPTION_LV2_PATH)) {
     if (lilv_node_is_string(value)) {
       free(world->opt.lv2_path);
       world->opt.lv2_path = lilv_strdup(lilv_node_as_string(value));
       return;
     }
+  } else if (!strcmp(uri, LILV_OPTION_MMAP)) {
+    if (!value || value->type == LILV_VALUE_BOOL) {
+      world->opt.mmap = lilv_node_as_bool(value);
+      return;
+    }
   } else if (!strcmp(uri, LILV_OPTION_OBJECT_INDEX)) {
     if (!value || value->type == LILV_VALUE_BOOL) {
       world->opt.object_index = lilv_node_as_bool(value);
       return;
     }
+  } else if (!strcmp(uri, LILV_OPTION_QUERY_CACHE_SIZE)) {
+    if (lilv_node_is_int(value) && lilv_node_as_int(value) >= 0) {
+      lilv_query_cache_free(world->query_cache, world->world);
+      world->query_cache = NULL;
+      if (lilv_node_as_int(value) > 0) {
+        world->query_cache =
+          lilv_query_cache_new((size_t)lilv_node_as_int(value));
+      }
+      return;
+    }
+  } else if (!strcmp(uri, LILV_OPTION_STATS)) {
+    if (!value || value->type == LILV_VALUE_BOOL) {
+      world->opt.stats = lilv_node_as_bool(value);
+      if (world->opt.stats && !world->bundle_stats) {
+        world->bundle_stats = lilv_stats_hash_new();
+        world->file_stats   = lilv_stats_hash_new();
+        world->opt.stats    = world->bundle_stats && world->file_stats;
+      }
+      return;
+    }
   }
   LILV_WARNF("Unrecognized or invalid option `%s'\n", uri);
 }
@@ -193,6 +324,95 @@ allocate_model_if_necessary(LilvWorld* world)
   }
 }
 
+/// The state of the world when loading a file started, for statistics
+typedef struct {
+  uint64_t time;         ///< Start time in nanoseconds
+  size_t   n_statements; ///< Number of statements in the model
+} LoadStart;
+
+static LoadStart
+lilv_world_begin_load(const LilvWorld* const world)
+{
+  LoadStart start = {0U, 0U};
+  if (world->opt.stats) {
+    start.time         = lilv_time_ns();
+    start.n_statements = sord_num_quads(world->model);
+  }
+
+  return start;
+}
+
+// Return the statistics for the loaded bundle that contains a file, or null
+static LilvLoadStats*
+lilv_world_find_bundle_stats(LilvWorld* const world, const SordNode* const file)
+{
+  const SordNode* const bundle =
+    lilv_file_index_find_bundle(world->file_index, world->world, file);
+
+  return bundle ? lilv_stats_hash_find(world->bundle_stats, bundle) : NULL;
+}
+
+// Record statistics for a file that has been loaded since `start`
+static void
+lilv_world_end_load(LilvWorld* const      world,
+                    const SordNode* const uri,
+                    const LoadStart       start,
+                    const bool            parsed)
+{
+  if (!world->opt.stats) {
+    return;
+  }
+
+  const size_t n_statements = sord_num_quads(world->model);
+
+  LilvLoadStats stats = {1U, 0U, 0U, lilv_time_ns() - start.time, 0U, 0U};
+  if (n_statements > start.n_statements) {
+    stats.n_statements = n_statements - start.n_statements;
+  }
+
+  if (parsed) {
+    const char* const uri_str = (const char*)sord_node_get_string(uri);
+    char* const       path    = lilv_file_uri_parse(uri_str, NULL);
+    LilvFileStamp     stamp   = {0, 0U};
+    if (path && !lilv_file_stamp(path, &stamp)) {
+      stats.n_bytes = stamp.size;
+    }
+
+    lilv_free(path);
+  }
+
+  LilvLoadStats* const file_stats =
+    lilv_stats_hash_insert(world->file_stats, uri);
+  if (file_stats) {
+    lilv_load_stats_add(file_stats, &stats);
+  }
+
+  LilvLoadStats* const bundle_stats = lilv_world_find_bundle_stats(world, uri);
+  if (bundle_stats) {
+    lilv_load_stats_add(bundle_stats, &stats);
+  }
+
+  lilv_load_stats_add(&world->stats.total, &stats);
+}
+
+// Record time spent loading a bundle besides reading files
+static void
+lilv_world_add_bundle_time(LilvWorld* const      world,
+                           const SordNode* const bundle,
+                           const uint64_t        version_time,
+                           const uint64_t        dyn_manifest_time)
+{
+  const LilvLoadStats stats = {0U, 0U, 0U, 0U, version_time, dyn_manifest_time};
+
+  LilvLoadStats* const bundle_stats =
+    lilv_stats_hash_insert(world->bundle_stats, bundle);
+  if (bundle_stats) {
+    lilv_load_stats_add(bundle_stats, &stats);
+  }
+
+  lilv_load_stats_add(&world->stats.total, &stats);
+}
+
 #define WARN_INDEX(w, s, p, o)                                          \
   do {                                                                  \
     if (!s && !world->opt.object_index) {                               \
@@ -200,34 +420,46 @@ allocate_model_if_necessary(LilvWorld* world)
     }                                                                   \
   } while (0)
 
-LilvNodes*
-lilv_world_find_nodes(LilvWorld*      world,
-                      const LilvNode* subject,
-                      const LilvNode* predicate,
-                      const LilvNode* object)
+/// Return true if a pattern can be used to find nodes, or log an error
+static bool
+lilv_world_check_pattern(const LilvNode* const subject,
+                         const LilvNode* const predicate,
+                         const LilvNode* const object)
 {
-  allocate_model_if_necessary(world);
-  WARN_INDEX(world, subject, predicate, object);
-
   if (subject && !lilv_node_is_uri(subject) && !lilv_node_is_blank(subject)) {
     LILV_ERRORF("Subject \"%s\" is not a resource\n",
                 sord_node_get_string(subject->node));
-    return NULL;
+    return false;
   }
 
   if (!predicate) {
     LILV_ERROR("Missing required predicate\n");
-    return NULL;
+    return false;
   }
 
   if (!lilv_node_is_uri(predicate)) {
     LILV_ERRORF("Predicate \"%s\" is not a URI\n",
                 sord_node_get_string(predicate->node));
-    return NULL;
+    return false;
   }
 
   if (!subject && !object) {
     LILV_ERROR("Both subject and object are NULL\n");
+    return false;
+  }
+
+  return true;
+}
+
+LilvNodes*
+lilv_world_find_nodes(LilvWorld*      world,
+                      const LilvNode* subject,
+                      const LilvNode* predicate,
+                      const LilvNode* object)
+{
+  allocate_model_if_necessary(world);
+  WARN_INDEX(world, subject, predicate, object);
+  if (!lilv_world_check_pattern(subject, predicate, object)) {
     return NULL;
   }
 
@@ -238,6 +470,28 @@ lilv_world_find_nodes(LilvWorld*      world,
                                  NULL);
 }
 
+unsigned
+lilv_world_foreach_match(LilvWorld* const      world,
+                         const LilvNode* const subject,
+                         const LilvNode* const predicate,
+                         const LilvNode* const object,
+                         const LilvNodeFunc    func,
+                         void* const           user_data)
+{
+  allocate_model_if_necessary(world);
+  WARN_INDEX(world, subject, predicate, object);
+  if (!lilv_world_check_pattern(subject, predicate, object)) {
+    return 0U;
+  }
+
+  return lilv_visit_nodes(world,
+                          subject ? subject->node : NULL,
+                          predicate->node,
+                          object ? object->node : NULL,
+                          func,
+                          user_data);
+}
+
 const SordNode*
 lilv_world_get_unique(LilvWorld* const world,
                       const SordNode*  subject,
@@ -261,27 +515,110 @@ lilv_world_get_unique(LilvWorld* const world,
   return object;
 }
 
-LilvNode*
-lilv_world_get(LilvWorld*      world,
-               const LilvNode* subject,
-               const LilvNode* predicate,
-               const LilvNode* object)
+/// Return a new reference to the node that matches a pattern using the cache
+static SordNode*
+lilv_world_get_cached(LilvWorld* const      world,
+                      const SordNode* const s,
+                      const SordNode* const p,
+                      const SordNode* const o)
+{
+  QueryCache* const cache = world->query_cache;
+
+  lilv_query_cache_update(cache, world->world, world->generation);
+
+  const QueryRecord* const record = lilv_query_cache_find(cache, s, p, o);
+  if (record) {
+    ++world->stats.n_query_hits;
+    return sord_node_copy(record->result);
+  }
+
+  ++world->stats.n_query_misses;
+
+  SordNode* const result = o ? sord_get(world->model, s, p, o, NULL)
+                             : sord_node_copy(lilv_find_object(world, s, p));
+
+  // Return another reference if the cache takes this one
+  return lilv_query_cache_insert(cache, world->world, s, p, o, result)
+           ? result
+           : sord_node_copy(result);
+}
+
+/// Return a new reference to the node that matches a pattern, or null
+static SordNode*
+lilv_world_get_match(LilvWorld* const      world,
+                     const LilvNode* const subject,
+                     const LilvNode* const predicate,
+                     const LilvNode* const object)
 {
   const SordNode* const s = subject ? subject->node : NULL;
   const SordNode* const p = predicate ? predicate->node : NULL;
+  lilv_world_load_specs_for(world, s, p, object ? object->node : NULL);
+  if (world->query_cache && world->model) {
+    if (object) {
+      WARN_INDEX(world, subject, predicate, object);
+    }
+
+    return lilv_world_get_cached(world, s, p, object ? object->node : NULL);
+  }
+
   if (!object) {
-    return lilv_node_from_object(world, s, p);
+    return sord_node_copy(lilv_find_object(world, s, p));
   }
 
   allocate_model_if_necessary(world);
   WARN_INDEX(world, subject, predicate, object);
 
-  SordNode* snode = sord_get(world->model, s, p, object->node, NULL);
-  LilvNode* lnode = lilv_node_new_from_node(world, snode);
+  return sord_get(world->model, s, p, object->node, NULL);
+}
+
+LilvNode*
+lilv_world_get(LilvWorld*      world,
+               const LilvNode* subject,
+               const LilvNode* predicate,
+               const LilvNode* object)
+{
+  SordNode* const snode =
+    lilv_world_get_match(world, subject, predicate, object);
+
+  LilvNode* const lnode = lilv_node_new_from_node(world, snode);
   sord_node_free(world->world, snode);
   return lnode;
 }
 
+const LilvNode*
+lilv_world_get_shared(LilvWorld* const      world,
+                      const LilvNode* const subject,
+                      const LilvNode* const predicate,
+                      const LilvNode* const object)
+{
+  SordNode* const snode =
+    lilv_world_get_match(world, subject, predicate, object);
+
+  const LilvNode* const lnode =
+    lilv_node_pool_intern(world->shared_nodes, world, snode);
+  sord_node_free(world->world, snode);
+  return lnode;
+}
+
+unsigned
+lilv_world_get_values(LilvWorld* const             world,
+                      const LilvNode* const        subject,
+                      const unsigned               n_predicates,
+                      const LilvNode* const* const predicates,
+                      LilvNode** const             values)
+{
+  if (!lilv_node_is_uri(subject) && !lilv_node_is_blank(subject)) {
+    LILV_ERRORF("Subject \"%s\" is not a resource\n",
+                sord_node_get_string(subject->node));
+    memset(values, 0, n_predicates * sizeof(LilvNode*));
+    return 0U;
+  }
+
+  allocate_model_if_necessary(world);
+  return lilv_nodes_from_objects(
+    world, subject->node, n_predicates, predicates, values);
+}
+
 bool
 lilv_world_ask(LilvWorld*      world,
                const LilvNode* subject,
@@ -291,11 +628,12 @@ lilv_world_ask(LilvWorld*      world,
   allocate_model_if_necessary(world);
   WARN_INDEX(world, subject, predicate, object);
 
-  return sord_ask(world->model,
-                  subject ? subject->node : NULL,
-                  predicate ? predicate->node : NULL,
-                  object ? object->node : NULL,
-                  NULL);
+  const SordNode* const s = subject ? subject->node : NULL;
+  const SordNode* const p = predicate ? predicate->node : NULL;
+  const SordNode* const o = object ? object->node : NULL;
+  lilv_world_load_specs_for(world, s, p, o);
+
+  return sord_ask(world->model, s, p, o, NULL);
 }
 
 const uint8_t*
@@ -340,38 +678,18 @@ lilv_lib_compare(const void* a, const void* b, const void* user_data)
   return cmp ? cmp : strcmp(lib_a->bundle_path, lib_b->bundle_path);
 }
 
-// Get an element of a collection of any object with an LilvHeader by URI
-static ZixTreeIter*
-lilv_collection_find_by_uri(const ZixTree* seq, const LilvNode* uri)
-{
-  ZixTreeIter* i = NULL;
-  if (lilv_node_is_uri(uri)) {
-    struct LilvHeader key = {NULL, (LilvNode*)uri};
-    (void)zix_tree_find(seq, &key, &i);
-  }
-  return i;
-}
-
-// Get an element of a collection of any object with an LilvHeader by URI
-struct LilvHeader*
-lilv_collection_get_by_uri(const ZixTree* seq, const LilvNode* uri)
-{
-  const ZixTreeIter* const i = lilv_collection_find_by_uri(seq, uri);
-
-  return i ? (struct LilvHeader*)zix_tree_get(i) : NULL;
-}
-
-// Add all rdfs:seeAlso files of subject to tree
+// Add all rdfs:seeAlso files of subject to a collection
 static void
 lilv_world_collect_data_files(LilvWorld*            world,
                               const SordNode* const subject,
-                              ZixTree* const        tree)
+                              LilvNodes* const      data_uris)
 {
   SordIter* files =
     sord_search(world->model, subject, world->uris.rdfs_seeAlso, NULL, NULL);
   FOREACH_MATCH (files) {
     const SordNode* file_node = sord_iter_get_node(files, SORD_OBJECT);
-    zix_tree_insert(tree, lilv_node_new_from_node(world, file_node), NULL);
+    lilv_collection_insert(data_uris,
+                           lilv_node_new_from_node(world, file_node));
   }
   sord_iter_free(files);
 }
@@ -385,10 +703,10 @@ lilv_world_add_spec(LilvWorld*      world,
   spec->spec      = sord_node_copy(specification_node);
   spec->bundle    = sord_node_copy(bundle_node);
   spec->data_uris = lilv_nodes_new();
+  spec->loaded    = false;
 
   // Add all data files (rdfs:seeAlso)
-  lilv_world_collect_data_files(
-    world, specification_node, (ZixTree*)spec->data_uris);
+  lilv_world_collect_data_files(world, specification_node, spec->data_uris);
 
   // Add specification to world specification list
   spec->next   = world->specs;
@@ -408,15 +726,13 @@ lilv_world_add_plugin(LilvWorld*      world,
   LilvNode* const plugin_uri = lilv_node_new_from_node(world, plugin_node);
   assert(!lilv_plugins_get_by_uri(world->plugins, plugin_uri));
 
-  ZixTreeIter* const z =
-    lilv_collection_find_by_uri((const ZixTree*)world->zombies, plugin_uri);
+  LilvPlugin* plugin =
+    (LilvPlugin*)lilv_collection_remove_by_uri(world->zombies, plugin_uri);
 
-  LilvPlugin* plugin = NULL;
-  if (z) {
+  if (plugin) {
     // Plugin bundle has been re-loaded, move from zombies to plugins
-    plugin = (LilvPlugin*)zix_tree_get(z);
-    zix_tree_remove((ZixTree*)world->zombies, z);
-    zix_tree_insert((ZixTree*)world->plugins, plugin, NULL);
+    lilv_collection_insert(world->plugins, plugin);
+    lilv_plugin_hash_insert(world->plugin_index, plugin);
     lilv_node_free(plugin_uri);
     lilv_plugin_clear(plugin, lilv_node_new_from_node(world, bundle));
   } else {
@@ -425,12 +741,16 @@ lilv_world_add_plugin(LilvWorld*      world,
       world, plugin_uri, lilv_node_new_from_node(world, bundle));
 
     // Add manifest as plugin data file (as if it were rdfs:seeAlso)
-    zix_tree_insert((ZixTree*)plugin->data_uris,
-                    lilv_node_new_from_node(world, manifest_node),
-                    NULL);
+    lilv_collection_insert(plugin->data_uris,
+                           lilv_node_new_from_node(world, manifest_node));
 
     // Add plugin to world plugin sequence
-    zix_tree_insert((ZixTree*)world->plugins, plugin, NULL);
+    lilv_collection_insert(world->plugins, plugin);
+    lilv_plugin_hash_insert(world->plugin_index, plugin);
+  }
+
+  if (world->search_index) {
+    lilv_search_index_add(world->search_index, plugin);
   }
 
 #ifdef LILV_DYN_MANIFEST
@@ -442,8 +762,7 @@ lilv_world_add_plugin(LilvWorld*      world,
 #endif
 
   // Add all plugin data files (rdfs:seeAlso)
-  lilv_world_collect_data_files(
-    world, plugin_node, (ZixTree*)plugin->data_uris);
+  lilv_world_collect_data_files(world, plugin_node, plugin->data_uris);
 }
 
 static SerdStatus
@@ -580,6 +899,7 @@ lilv_world_load_dyn_manifest(LilvWorld*      world,
     serd_reader_set_default_graph(reader, sord_node_to_serd_node(dmanifest));
     serd_reader_add_blank_prefix(reader, lilv_world_blank_node_prefix(world));
     serd_reader_read_file_handle(reader, fd, (const uint8_t*)"(dyn-manifest)");
+    ++world->generation;
 
     plugins = node_skimmer_free(skimmer);
 
@@ -721,14 +1041,42 @@ load_version(LilvWorld* const      world,
   return skimmed.version;
 }
 
+/**
+   Return the version of a resource in a bundle.
+
+   The version is usually recorded when the manifest is first read, otherwise
+   it's skimmed from the manifest and any seeAlso files, then recorded so
+   this is only done once.
+*/
+static LilvVersion
+lilv_world_get_version(LilvWorld* const      world,
+                       const SordNode* const bundle_node,
+                       const SordNode* const resource)
+{
+  const LilvVersion* const recorded =
+    lilv_version_hash_find(world->versions, bundle_node, resource);
+  if (recorded) {
+    return *recorded;
+  }
+
+  const LilvVersion  version = load_version(world, bundle_node, resource);
+  LilvVersion* const record =
+    lilv_version_hash_insert(world->versions, bundle_node, resource);
+  if (record) {
+    *record = version;
+  }
+
+  return version;
+}
+
 static int
 lilv_world_compare_versions(LilvWorld* const      world,
                             const SordNode* const old_bundle,
                             const SordNode* const new_bundle,
                             const SordNode* const resource)
 {
-  LilvVersion old_version = load_version(world, old_bundle, resource);
-  LilvVersion new_version = load_version(world, new_bundle, resource);
+  LilvVersion old_version = lilv_world_get_version(world, old_bundle, resource);
+  LilvVersion new_version = lilv_world_get_version(world, new_bundle, resource);
   const int   cmp         = lilv_version_cmp(&new_version, &old_version);
   if (cmp > 0) {
     LILV_WARNF("Loading new version %d.%d of <%s> from <%s>\n",
@@ -782,6 +1130,14 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
   LilvNode* const manifest = lilv_new_uri(world, (const char*)manifest_uri);
   zix_free(NULL, manifest_uri);
 
+  // Add the bundle to the index so files in it are indexed under it
+  lilv_file_index_add_bundle(world->file_index, bundle_node);
+
+  // Add a statistics record so files in this bundle are counted towards it
+  if (world->opt.stats) {
+    lilv_stats_hash_insert(world->bundle_stats, bundle_node);
+  }
+
   // Set up a skimmer to skim for supported types as the manifest is loaded
   NodeHash*          plugins = NULL;
   NodeHash*          specs   = NULL;
@@ -797,12 +1153,17 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
                      world->applications,
                      world->subclasses);
 
+  // Record the versions of resources in the manifest to compare later
+  skimmer->versions = world->versions;
+  skimmer->bundle   = bundle_node;
+
   // Set up reader so statements have the bundle node as graph
   SerdReader* reader = skimmer->base.reader;
   serd_reader_set_default_graph(reader, sord_node_to_serd_node(bundle_node));
 
   // Read manifest into model and skim for any plugins
-  const SerdStatus st = lilv_world_load_file(world, reader, manifest->node);
+  const SerdStatus st = lilv_world_load_discovery_file(
+    world, &skimmer->base, bundle_node, manifest->node);
   if (st > SERD_FAILURE) {
     LILV_ERRORF("Error reading <%s>\n", lilv_node_as_string(manifest));
     lilv_node_free(manifest);
@@ -822,14 +1183,20 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
       const LilvNode* last_bundle = lilv_plugin_get_bundle_uri(plugin);
       if (!sord_node_equals(bundle_node, last_bundle->node)) {
         // Some version was previously loaded from a different bundle
-        const int cmp = lilv_world_compare_versions(
+        const uint64_t t_start = world->opt.stats ? lilv_time_ns() : 0U;
+        const int      cmp     = lilv_world_compare_versions(
           world, last_bundle->node, bundle_uri->node, uri->node);
+        if (world->opt.stats) {
+          lilv_world_add_bundle_time(
+            world, bundle_node, lilv_time_ns() - t_start, 0U);
+        }
         if (cmp > 0) { // Enqueue replacement with newer version
-          zix_tree_insert(
-            (ZixTree*)unload_uris, lilv_node_duplicate(uri), NULL);
+          lilv_collection_insert(unload_uris, lilv_node_duplicate(uri));
         } else if (cmp <= 0) { // Ignore older or equivalent version
           lilv_node_free(uri);
           lilv_world_drop_graph(world, bundle_node);
+          lilv_version_hash_remove_bundle(
+            world->versions, world->world, bundle_node);
           lilv_node_free(manifest);
           lilv_nodes_free(unload_uris);
           type_skimmer_free(skimmer);
@@ -851,8 +1218,7 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
 
     // Unload plugin and record bundle for later unloading
     lilv_world_unload_resource(world, uri);
-    zix_tree_insert(
-      (ZixTree*)unload_bundles, lilv_node_duplicate(bundle), NULL);
+    lilv_collection_insert(unload_bundles, lilv_node_duplicate(bundle));
   }
   lilv_nodes_free(unload_uris);
 
@@ -871,7 +1237,12 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
   }
 
   // Load dynamic manifest and its data if available
+  const uint64_t dman_start = world->opt.stats ? lilv_time_ns() : 0U;
   lilv_world_load_dyn_manifest(world, bundle_node, manifest->node);
+  if (world->opt.stats) {
+    lilv_world_add_bundle_time(
+      world, bundle_node, 0U, lilv_time_ns() - dman_start);
+  }
 
   // Load specifications (lv2:Specification or owl:Ontology)
   NODE_HASH_FOREACH (s, specs) {
@@ -888,6 +1259,8 @@ lilv_world_load_bundle(LilvWorld* world, const LilvNode* bundle_uri)
 static int
 lilv_world_drop_graph(LilvWorld* world, const SordNode* graph)
 {
+  ++world->generation;
+
   SordIter* i = sord_search(world->model, NULL, NULL, NULL, graph);
   while (!sord_iter_end(i)) {
     const SerdStatus st = sord_erase(world->model, i);
@@ -904,6 +1277,38 @@ lilv_world_drop_graph(LilvWorld* world, const SordNode* graph)
   return 0;
 }
 
+/**
+   Remove the specifications in a bundle.
+
+   Specification data files are read without a graph, so their statements
+   can't be dropped with the bundle.  The data files of loaded specifications
+   are removed from `files` so they stay loaded and aren't read again.
+*/
+static void
+lilv_world_remove_specs(LilvWorld* const      world,
+                        const SordNode* const bundle,
+                        NodeHash* const       files)
+{
+  LilvSpec** link = &world->specs;
+  while (*link) {
+    LilvSpec* const spec = *link;
+    if (!sord_node_equals(spec->bundle, bundle)) {
+      link = &spec->next;
+      continue;
+    }
+
+    if (spec->loaded && files) {
+      LILV_FOREACH (nodes, f, spec->data_uris) {
+        const LilvNode* const file = lilv_nodes_get(spec->data_uris, f);
+        lilv_node_hash_remove(files, world->world, file->node);
+      }
+    }
+
+    *link = spec->next;
+    lilv_spec_free(world, spec);
+  }
+}
+
 int
 lilv_world_unload_bundle(LilvWorld* world, const LilvNode* bundle_uri)
 {
@@ -911,26 +1316,12 @@ lilv_world_unload_bundle(LilvWorld* world, const LilvNode* bundle_uri)
     return 0;
   }
 
-  // Collect loaded files from this bundle (the actual data is dropped below)
-  NodeHash* unload_files = lilv_node_hash_new(NULL);
-  NODE_HASH_FOREACH (i, world->loaded_files) {
-    const SordNode* const file = lilv_node_hash_get(world->loaded_files, i);
-
-    size_t               file_len = 0U;
-    const uint8_t* const file_str =
-      sord_node_get_string_counted(file, &file_len);
+  // Take the loaded files in this bundle (the actual data is dropped below)
+  NodeHash* const unload_files = lilv_file_index_remove_bundle(
+    world->file_index, world->world, bundle_uri->node);
 
-    size_t               bundle_len = 0U;
-    const uint8_t* const bundle_str =
-      sord_node_get_string_counted(bundle_uri->node, &bundle_len);
-
-    if (file && (sord_node_equals(file, bundle_uri->node) ||
-                 (file_len > bundle_len && !strncmp((const char*)file_str,
-                                                    (const char*)bundle_str,
-                                                    bundle_len)))) {
-      lilv_node_hash_insert(unload_files, sord_node_copy(file));
-    }
-  }
+  // Remove specifications, keeping any data files that can't be dropped
+  lilv_world_remove_specs(world, bundle_uri->node, unload_files);
 
   // Remove files from world records so they'll be read again if loaded
   NODE_HASH_FOREACH (i, unload_files) {
@@ -940,33 +1331,62 @@ lilv_world_unload_bundle(LilvWorld* world, const LilvNode* bundle_uri)
 
   lilv_node_hash_free(unload_files, world->world);
 
+  // Forget versions so they're recorded again if the bundle is loaded
+  lilv_version_hash_remove_bundle(
+    world->versions, world->world, bundle_uri->node);
+
   /* Remove any plugins in the bundle from the plugin list.  Since the
      application may still have a pointer to the LilvPlugin, it can not be
      destroyed here.  Instead, we move it to the zombie plugin list, so it
      will not be in the list returned by lilv_world_get_all_plugins() but can
      still be used.
   */
-  ZixTreeIter* i = zix_tree_begin((ZixTree*)world->plugins);
-  while (i && i != zix_tree_end((ZixTree*)world->plugins)) {
-    LilvPlugin*  p    = (LilvPlugin*)zix_tree_get(i);
-    ZixTreeIter* next = zix_tree_iter_next(i);
+  unsigned i = 0U;
+  while (i < lilv_plugins_size(world->plugins)) {
+    LilvPlugin* const p =
+      (LilvPlugin*)lilv_collection_get_at(world->plugins, i);
 
     if (lilv_node_equals(lilv_plugin_get_bundle_uri(p), bundle_uri)) {
-      zix_tree_remove((ZixTree*)world->plugins, i);
-      zix_tree_insert((ZixTree*)world->zombies, p, NULL);
+      lilv_collection_remove_at(world->plugins, i);
+      lilv_collection_insert(world->zombies, p);
+      lilv_plugin_hash_remove(world->plugin_index, p->plugin_uri->node);
+      lilv_plugin_free_port_caches(p);
+      if (world->search_index) {
+        lilv_search_index_remove(world->search_index, p);
+      }
+    } else {
+      ++i;
     }
-
-    i = next;
   }
 
   // Drop everything in bundle graph
   return lilv_world_drop_graph(world, bundle_uri->node);
 }
 
+/// A list of bundles found in the LV2 path, in the order they were found
+typedef struct {
+  LilvWorld* world;
+  LilvNode** bundles;
+  size_t     n_bundles;
+} BundleList;
+
+// Return a new bundle URI node for a bundle directory path
+static LilvNode*
+lilv_world_new_bundle_uri(LilvWorld* const world, const char* const path)
+{
+  char* const base = zix_path_join(NULL, path, NULL);
+  SerdNode    suri = serd_node_new_file_uri((const uint8_t*)base, 0, 0, true);
+  LilvNode*   node = lilv_new_uri(world, (const char*)suri.buf);
+
+  serd_node_free(&suri);
+  zix_free(NULL, base);
+  return node;
+}
+
 static void
 load_dir_entry(const char* dir, const char* name, void* data)
 {
-  LilvWorld* const  world = (LilvWorld*)data;
+  BundleList* const list  = (BundleList*)data;
   char* const       path  = zix_path_join(NULL, dir, name);
   const ZixFileType type  = zix_file_type(path);
   if (type != ZIX_FILE_TYPE_DIRECTORY) {
@@ -977,26 +1397,29 @@ load_dir_entry(const char* dir, const char* name, void* data)
     return;
   }
 
-  char* const base = zix_path_join(NULL, path, NULL);
-  SerdNode    suri = serd_node_new_file_uri((const uint8_t*)base, 0, 0, true);
-  LilvNode*   node = lilv_new_uri(world, (const char*)suri.buf);
+  LilvNode* const node = lilv_world_new_bundle_uri(list->world, path);
+
+  LilvNode** const bundles = (LilvNode**)realloc(
+    list->bundles, (list->n_bundles + 1U) * sizeof(LilvNode*));
+  if (bundles) {
+    list->bundles                    = bundles;
+    list->bundles[list->n_bundles++] = node;
+  } else {
+    lilv_node_free(node);
+  }
 
-  lilv_world_load_bundle(world, node);
-  lilv_node_free(node);
-  serd_node_free(&suri);
-  free(base);
   free(path);
 }
 
-// Load all bundles in the directory at `dir_path`
+// Find all bundles in the directory at `dir_path`
 static void
-lilv_world_load_directory(LilvWorld* world, const char* dir_path)
+lilv_world_find_bundles(void* const data, const char* const dir_path)
 {
   char* const path = zix_expand_environment_strings(NULL, dir_path);
   if (path) {
     const ZixFileType type = zix_file_type(path);
     if (type == ZIX_FILE_TYPE_DIRECTORY) {
-      zix_dir_for_each(path, world, load_dir_entry);
+      zix_dir_for_each(path, data, load_dir_entry);
     } else if (type != ZIX_FILE_TYPE_NONE) {
       LILV_WARNF("Skipping non-directory `%s' in path\n", path);
     }
@@ -1015,13 +1438,46 @@ first_path_len(const char* path)
   return 0U;
 }
 
-/** Load all bundles found in `lv2_path`.
- * @param lv2_path A colon-delimited list of directories.  These directories
- * should contain LV2 bundle directories (ie the search path is a list of
- * parent directories of bundles, not a list of bundle directories).
- */
+// Read the manifests of all bundles in a list into the cache in parallel
 static void
-lilv_world_load_path(LilvWorld* world, const char* lv2_path)
+lilv_world_prefetch_manifests(LilvWorld* const world, const BundleList* list)
+{
+  CacheRequest* const requests =
+    (CacheRequest*)calloc(list->n_bundles + 1U, sizeof(CacheRequest));
+  if (!requests) {
+    return;
+  }
+
+  size_t n_requests = 0U;
+  for (size_t i = 0U; i < list->n_bundles; ++i) {
+    const SordNode* const bundle_node  = list->bundles[i]->node;
+    uint8_t* const        manifest_uri = lilv_manifest_uri(bundle_node);
+    if (manifest_uri) {
+      requests[n_requests].uri  = sord_new_uri(world->world, manifest_uri);
+      requests[n_requests].base = bundle_node;
+      ++n_requests;
+      zix_free(NULL, manifest_uri);
+    }
+  }
+
+  lilv_cache_prefetch(world->cache,
+                      n_requests,
+                      requests,
+                      world->opt.discovery_threads,
+                      world->opt.mmap);
+
+  for (size_t i = 0U; i < n_requests; ++i) {
+    sord_node_free(world->world, (SordNode*)requests[i].uri);
+  }
+
+  free(requests);
+}
+
+// Call `func` for every directory in `lv2_path`, in order
+static void
+for_each_path_dir(const char* lv2_path,
+                  void* const data,
+                  void (*const func)(void*, const char*))
 {
   while (lv2_path[0] != '\0') {
     const size_t dir_len = first_path_len(lv2_path);
@@ -1029,47 +1485,248 @@ lilv_world_load_path(LilvWorld* world, const char* lv2_path)
       char* const dir = (char*)malloc(dir_len + 1U);
       memcpy(dir, lv2_path, dir_len);
       dir[dir_len] = '\0';
-      lilv_world_load_directory(world, dir);
+      func(data, dir);
       free(dir);
       lv2_path += dir_len + 1;
     } else {
-      lilv_world_load_directory(world, lv2_path);
+      func(data, lv2_path);
       lv2_path = "\0";
     }
   }
 }
 
-void
-lilv_world_load_specifications(LilvWorld* world)
+// Find all bundles in every directory in `lv2_path`, in order
+static void
+lilv_world_find_path_bundles(BundleList* const list, const char* lv2_path)
 {
-  allocate_model_if_necessary(world);
+  for_each_path_dir(lv2_path, list, lilv_world_find_bundles);
+}
 
-  for (LilvSpec* spec = world->specs; spec; spec = spec->next) {
-    LILV_FOREACH (nodes, f, spec->data_uris) {
-      const LilvNode* file =
-        (const LilvNode*)lilv_collection_get(spec->data_uris, f);
+// Record the current stamps of a bundle from the path, then load it
+static void
+lilv_world_load_path_bundle(LilvWorld* const world, const LilvNode* bundle)
+{
+  LilvBundle* const record =
+    lilv_bundle_hash_insert(world->bundles, bundle->node);
+  if (record) {
+    const LilvFileStamp null_stamp = {0, 0U};
+    if (lilv_bundle_stamp(
+          bundle->node, &record->dir_stamp, &record->manifest_stamp)) {
+      record->dir_stamp      = null_stamp;
+      record->manifest_stamp = null_stamp;
+    }
 
-      const SerdNode* const base = sord_node_to_serd_node(file->node);
+    record->seen = true;
+  }
 
-      TypeSkimmer* const skimmer = type_skimmer_new(world->world,
-                                                    &world->uris,
-                                                    base,
-                                                    world->model,
-                                                    NULL,
-                                                    NULL,
-                                                    NULL,
-                                                    &world->replaced,
-                                                    world->applications,
-                                                    world->subclasses);
+  lilv_world_load_bundle(world, bundle);
+}
 
-      lilv_world_load_file(world, skimmer->base.reader, file->node);
+/**
+   Load, reload, or unload a bundle from the path to match the filesystem.
 
-      type_skimmer_free(skimmer);
-    }
-  }
-}
+   A bundle that is already loaded is only reloaded if its stamps, or the
+   stamps of any file that was loaded from it, have changed, unless `force` is
+   true.  A forced reload always unloads the bundle first, since it may have
+   been loaded without being recorded, for example by lilv_world_load_bundle().
 
-static ZixStatus
+   @return 1 if the bundle was changed, otherwise 0.
+*/
+static unsigned
+lilv_world_update_bundle(LilvWorld* const      world,
+                         const LilvNode* const bundle,
+                         const bool            force)
+{
+  LilvBundle* const record =
+    lilv_bundle_hash_find(world->bundles, bundle->node);
+
+  LilvFileStamp dir_stamp      = {0, 0U};
+  LilvFileStamp manifest_stamp = {0, 0U};
+  if (lilv_bundle_stamp(bundle->node, &dir_stamp, &manifest_stamp)) {
+    if (!record) {
+      return 0U;
+    }
+
+    // Bundle has been removed
+    lilv_world_unload_bundle(world, bundle);
+    lilv_bundle_hash_remove(world->bundles, world->world, bundle->node);
+    return 1U;
+  }
+
+  if (record) {
+    record->seen = true;
+    if (!force && lilv_file_stamp_equals(&dir_stamp, &record->dir_stamp) &&
+        lilv_file_stamp_equals(&manifest_stamp, &record->manifest_stamp) &&
+        !lilv_file_index_bundle_changed(world->file_index, bundle->node)) {
+      return 0U;
+    }
+  }
+
+  // Bundle is new or has changed, but may be loaded even if it has no record
+  if (record || force) {
+    lilv_world_unload_bundle(world, bundle);
+  }
+
+  lilv_world_load_path_bundle(world, bundle);
+  return 1U;
+}
+
+/** Load all bundles found in `lv2_path`.
+ * @param lv2_path A colon-delimited list of directories.  These directories
+ * should contain LV2 bundle directories (ie the search path is a list of
+ * parent directories of bundles, not a list of bundle directories).
+ */
+static void
+lilv_world_load_path(LilvWorld* world, const char* lv2_path)
+{
+  BundleList list = {world, NULL, 0U};
+  lilv_world_find_path_bundles(&list, lv2_path);
+
+  // Read manifests in parallel if enabled, so loading below just replays them
+  if (world->cache && world->opt.discovery_threads > 1U) {
+    lilv_world_prefetch_manifests(world, &list);
+  }
+
+  // Load bundles in order (which may replace earlier plugin versions)
+  for (size_t i = 0U; i < list.n_bundles; ++i) {
+    lilv_world_load_path_bundle(world, list.bundles[i]);
+    lilv_node_free(list.bundles[i]);
+  }
+
+  free(list.bundles);
+}
+
+// Read all specification data files into the cache in parallel
+static void
+lilv_world_prefetch_specifications(LilvWorld* const world)
+{
+  size_t n_files = 0U;
+  for (const LilvSpec* spec = world->specs; spec; spec = spec->next) {
+    n_files += lilv_nodes_size(spec->data_uris);
+  }
+
+  CacheRequest* const requests =
+    (CacheRequest*)calloc(n_files + 1U, sizeof(CacheRequest));
+  if (!requests) {
+    return;
+  }
+
+  size_t n_requests = 0U;
+  for (const LilvSpec* spec = world->specs; spec; spec = spec->next) {
+    LILV_FOREACH (nodes, f, spec->data_uris) {
+      const LilvNode* const file = lilv_nodes_get(spec->data_uris, f);
+
+      requests[n_requests].uri  = file->node;
+      requests[n_requests].base = file->node;
+      ++n_requests;
+    }
+  }
+
+  lilv_cache_prefetch(world->cache,
+                      n_requests,
+                      requests,
+                      world->opt.discovery_threads,
+                      world->opt.mmap);
+
+  free(requests);
+}
+
+// Load all the data files of a specification
+static void
+lilv_world_load_spec(LilvWorld* const world, LilvSpec* const spec)
+{
+  spec->loaded = true;
+
+  LILV_FOREACH (nodes, f, spec->data_uris) {
+    const LilvNode* file =
+      (const LilvNode*)lilv_collection_get(spec->data_uris, f);
+
+    const SerdNode* const base = sord_node_to_serd_node(file->node);
+
+    TypeSkimmer* const skimmer = type_skimmer_new(world->world,
+                                                  &world->uris,
+                                                  base,
+                                                  world->model,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  &world->replaced,
+                                                  world->applications,
+                                                  world->subclasses);
+
+    lilv_world_load_discovery_file(world, &skimmer->base, NULL, file->node);
+
+    type_skimmer_free(skimmer);
+  }
+}
+
+// Load every specification that hasn't been loaded yet
+static void
+lilv_world_load_all_specs(LilvWorld* const world)
+{
+  if (world->cache && world->opt.discovery_threads > 1U) {
+    lilv_world_prefetch_specifications(world);
+  }
+
+  for (LilvSpec* spec = world->specs; spec; spec = spec->next) {
+    if (!spec->loaded) {
+      lilv_world_load_spec(world, spec);
+    }
+  }
+}
+
+// Return true if `uri` is in the namespace of `spec`
+static bool
+lilv_spec_has_term(const LilvSpec* const spec, const char* const uri)
+{
+  size_t            ns_len = 0U;
+  const char* const ns =
+    (const char*)sord_node_get_string_counted(spec->spec, &ns_len);
+
+  if (!ns_len || strncmp(uri, ns, ns_len)) {
+    return false;
+  }
+
+  const char last = ns[ns_len - 1U];
+  const char next = uri[ns_len];
+  return last == '#' || last == '/' || next == '\0' || next == '#' ||
+         next == '/';
+}
+
+void
+lilv_world_load_specs_for(LilvWorld* const      world,
+                          const SordNode* const subject,
+                          const SordNode* const predicate,
+                          const SordNode* const object)
+{
+  if (!world->opt.lazy_specs) {
+    return;
+  }
+
+  const SordNode* const nodes[] = {subject, predicate, object};
+  for (LilvSpec* spec = world->specs; spec; spec = spec->next) {
+    for (unsigned i = 0U; !spec->loaded && i < 3U; ++i) {
+      if (nodes[i] && sord_node_get_type(nodes[i]) == SORD_URI &&
+          lilv_spec_has_term(
+            spec, (const char*)sord_node_get_string(nodes[i]))) {
+        lilv_world_load_spec(world, spec);
+      }
+    }
+  }
+}
+
+void
+lilv_world_load_specifications(LilvWorld* world)
+{
+  allocate_model_if_necessary(world);
+
+  // Lazy specifications are loaded when first needed
+  if (!world->opt.lazy_specs) {
+    lilv_world_load_all_specs(world);
+  }
+}
+
+static ZixStatus
 lilv_world_add_plugin_class(LilvWorld* const      world,
                             const SordNode* const node,
                             const SordNode* const parent)
@@ -1089,7 +1746,7 @@ lilv_world_add_plugin_class(LilvWorld* const      world,
     LilvPluginClass* const klass = lilv_plugin_class_new(
       world, parent, uri, (const char*)sord_node_get_string(label));
     if (klass) {
-      st = zix_tree_insert((ZixTree*)world->plugin_classes, klass, NULL);
+      st = lilv_collection_insert(world->plugin_classes, klass);
       if (st) {
         lilv_plugin_class_free(klass);
       }
@@ -1100,11 +1757,152 @@ lilv_world_add_plugin_class(LilvWorld* const      world,
   return st;
 }
 
-void
-lilv_world_load_plugin_classes(LilvWorld* world)
+const LilvPluginClass*
+lilv_world_find_plugin_class(const LilvWorld* const world,
+                             const SordNode* const  uri)
 {
-  allocate_model_if_necessary(world);
+  const ClassIndex* const index = &world->class_index;
+  const char* const       str   = (const char*)sord_node_get_string(uri);
+
+  // Binary search classes, which are sorted by URI
+  uint32_t lo = 0U;
+  uint32_t hi = index->n_classes;
+  while (lo < hi) {
+    const uint32_t mid = lo + ((hi - lo) / 2U);
+    const char* const class_uri = lilv_node_as_uri(index->classes[mid]->uri);
+    const int         cmp       = strcmp(str, class_uri);
+    if (cmp < 0) {
+      hi = mid;
+    } else if (cmp > 0) {
+      lo = mid + 1U;
+    } else {
+      return index->classes[mid];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+   Index the loaded plugin classes.
+
+   This assigns every class a dense ID in URI order, groups the children of
+   each class together, and computes the transitive closure of all
+   rdfs:subClassOf statements between classes as a bitset for each class.
+*/
+static void
+lilv_world_index_plugin_classes(LilvWorld* const world)
+{
+  ClassIndex* const index = &world->class_index;
+  lilv_world_clear_class_index(world);
+
+  const uint32_t n_classes = lilv_plugin_classes_size(world->plugin_classes);
+  const uint32_t n_words   = (n_classes + 63U) / 64U;
+
+  index->classes =
+    (LilvPluginClass**)calloc(n_classes + 1U, sizeof(LilvPluginClass*));
+  index->children =
+    (LilvPluginClass**)calloc(n_classes + 1U, sizeof(LilvPluginClass*));
+  index->first_child = (uint32_t*)calloc(n_classes + 1U, sizeof(uint32_t));
+  index->ancestors =
+    (uint64_t*)calloc(((size_t)n_classes * n_words) + 1U, sizeof(uint64_t));
+  ++index->epoch;
+  if (!index->classes || !index->children || !index->first_child ||
+      !index->ancestors) {
+    lilv_world_clear_class_index(world); // Leave an empty index
+    return;
+  }
 
+  index->n_classes = n_classes;
+  index->n_words   = n_words;
+
+  // Assign IDs in URI order
+  uint32_t id = 0U;
+  LILV_FOREACH (plugin_classes, i, world->plugin_classes) {
+    LilvPluginClass* const klass =
+      (LilvPluginClass*)lilv_plugin_classes_get(world->plugin_classes, i);
+
+    klass->id            = id;
+    index->classes[id++] = klass;
+  }
+
+  const LilvPluginClass* const root =
+    lilv_world_find_plugin_class(world, world->uris.lv2_Plugin);
+  world->lv2_plugin_class->id = root ? root->id : UINT32_MAX;
+
+  // Count the children of each class, then group them with a prefix sum
+  const LilvPluginClass** const parents = (const LilvPluginClass**)calloc(
+    n_classes + 1U, sizeof(LilvPluginClass*));
+  uint32_t* const n_children =
+    (uint32_t*)calloc(n_classes + 1U, sizeof(uint32_t));
+  if (!parents || !n_children) {
+    free(n_children);
+    free(parents);
+    lilv_world_clear_class_index(world);
+    return;
+  }
+
+  for (uint32_t i = 0U; i < n_classes; ++i) {
+    const LilvNode* const parent_uri = index->classes[i]->parent_uri;
+    if (parent_uri) {
+      parents[i] = lilv_world_find_plugin_class(world, parent_uri->node);
+      if (parents[i]) {
+        ++index->first_child[parents[i]->id + 1U];
+      }
+    }
+  }
+
+  for (uint32_t i = 0U; i < n_classes; ++i) {
+    index->first_child[i + 1U] += index->first_child[i];
+  }
+
+  for (uint32_t i = 0U; i < n_classes; ++i) {
+    if (parents[i]) {
+      const uint32_t p = parents[i]->id;
+      index->children[index->first_child[p] + n_children[p]++] =
+        index->classes[i];
+    }
+  }
+
+  free(n_children);
+  free(parents);
+
+  // Every class is an ancestor of itself
+  for (uint32_t i = 0U; i < n_classes; ++i) {
+    index->ancestors[((size_t)i * n_words) + (i / 64U)] |= 1ULL << (i % 64U);
+  }
+
+  // Propagate ancestors along subclass statements until nothing changes
+  bool changed = true;
+  while (changed) {
+    changed = false;
+
+    SordIter* const s = sord_search(
+      world->subclasses, NULL, world->uris.rdfs_subClassOf, NULL, NULL);
+    FOREACH_MATCH (s) {
+      const LilvPluginClass* const child = lilv_world_find_plugin_class(
+        world, sord_iter_get_node(s, SORD_SUBJECT));
+      const LilvPluginClass* const parent = lilv_world_find_plugin_class(
+        world, sord_iter_get_node(s, SORD_OBJECT));
+
+      if (child && parent) {
+        uint64_t* const dst = index->ancestors + ((size_t)child->id * n_words);
+        const uint64_t* const src =
+          index->ancestors + ((size_t)parent->id * n_words);
+        for (uint32_t w = 0U; w < n_words; ++w) {
+          const uint64_t merged = dst[w] | src[w];
+          changed               = changed || merged != dst[w];
+          dst[w]                = merged;
+        }
+      }
+    }
+    sord_iter_free(s);
+  }
+}
+
+static void
+lilv_world_build_plugin_classes(LilvWorld* world)
+{
   const size_t     n_subclasses = sord_num_quads(world->subclasses);
   const SordNode** scratch      = (const SordNode**)zix_calloc(
     NULL, (2U * n_subclasses) + 1U, sizeof(SordNode*));
@@ -1143,10 +1941,34 @@ lilv_world_load_plugin_classes(LilvWorld* world)
   } while (n_added);
 
   zix_free(NULL, scratch);
+  lilv_world_index_plugin_classes(world);
 }
 
 void
-lilv_world_load_all(LilvWorld* world)
+lilv_world_load_plugin_classes(LilvWorld* world)
+{
+  allocate_model_if_necessary(world);
+
+  if (world->opt.lazy_specs) {
+    // Build classes when first needed, since that requires every specification
+    world->stale_classes = true;
+  } else {
+    lilv_world_build_plugin_classes(world);
+  }
+}
+
+void
+lilv_world_update_plugin_classes(LilvWorld* world)
+{
+  if (world->stale_classes) {
+    world->stale_classes = false;
+    lilv_world_load_all_specs(world);
+    lilv_world_build_plugin_classes(world);
+  }
+}
+
+static const char*
+lilv_world_lv2_path(const LilvWorld* const world)
 {
   const char* lv2_path = world->opt.lv2_path;
   if (!lv2_path) {
@@ -1156,19 +1978,254 @@ lilv_world_load_all(LilvWorld* world)
     lv2_path = LILV_DEFAULT_LV2_PATH;
   }
 
+  return lv2_path;
+}
+
+void
+lilv_world_load_all(LilvWorld* world)
+{
+  const char* const lv2_path = lilv_world_lv2_path(world);
+
+  // Read the discovery cache if it's enabled
+  char* const cache_path =
+    world->opt.cache_dir
+      ? zix_path_join(NULL, world->opt.cache_dir, "discovery.cache")
+      : NULL;
+
+  // Use a temporary cache for merging if discovery threads are enabled
+  if ((cache_path || world->opt.discovery_threads > 1U) && !world->cache) {
+    world->cache = lilv_cache_new(world->world);
+  }
+
+  if (cache_path && world->cache) {
+    lilv_cache_read(world->cache, cache_path);
+  }
+
   // Discover bundles and read all manifest files into model
   lilv_world_load_path(world, lv2_path);
 
   // Query out things to cache
   lilv_world_load_specifications(world);
   lilv_world_load_plugin_classes(world);
+
+  // Write the discovery cache, dropping entries for files that weren't seen
+  if (cache_path && world->cache) {
+    if (!zix_create_directories(NULL, world->opt.cache_dir)) {
+      lilv_cache_write(world->cache, cache_path);
+    } else {
+      LILV_ERRORF("Failed to create cache directory %s\n",
+                  world->opt.cache_dir);
+    }
+  }
+
+  lilv_cache_free(world->cache);
+  world->cache = NULL;
+
+  zix_free(NULL, cache_path);
 }
 
-SerdStatus
-lilv_world_load_file(LilvWorld* world, SerdReader* reader, const SordNode* uri)
+unsigned
+lilv_world_rescan(LilvWorld* world)
 {
   allocate_model_if_necessary(world);
 
+  BUNDLE_HASH_FOREACH (i, world->bundles) {
+    lilv_bundle_hash_get(world->bundles, i)->seen = false;
+  }
+
+  // Find all bundles that are currently in the path
+  BundleList list = {world, NULL, 0U};
+  lilv_world_find_path_bundles(&list, lilv_world_lv2_path(world));
+
+  // Load any new bundles and reload any that have changed
+  unsigned n_changed = 0U;
+  for (size_t i = 0U; i < list.n_bundles; ++i) {
+    n_changed += lilv_world_update_bundle(world, list.bundles[i], false);
+    lilv_node_free(list.bundles[i]);
+  }
+
+  free(list.bundles);
+
+  // Collect records of bundles that have been removed
+  NodeHash* const removed = lilv_node_hash_new(NULL);
+  BUNDLE_HASH_FOREACH (i, world->bundles) {
+    const LilvBundle* const record = lilv_bundle_hash_get(world->bundles, i);
+    if (!record->seen) {
+      lilv_node_hash_insert_copy(removed, record->uri);
+    }
+  }
+
+  // Unload removed bundles and forget about them
+  NODE_HASH_FOREACH (i, removed) {
+    const SordNode* const node   = lilv_node_hash_get(removed, i);
+    LilvNode* const       bundle = lilv_node_new_from_node(world, node);
+
+    lilv_world_unload_bundle(world, bundle);
+    lilv_bundle_hash_remove(world->bundles, world->world, node);
+    lilv_node_free(bundle);
+    ++n_changed;
+  }
+
+  lilv_node_hash_free(removed, world->world);
+
+  // Load any new specifications and plugin classes
+  if (n_changed) {
+    lilv_world_load_specifications(world);
+    lilv_world_load_plugin_classes(world);
+  }
+
+  return n_changed;
+}
+
+static void
+watch_bundle_entry(const char* dir, const char* name, void* data)
+{
+  Watcher* const watcher = (Watcher*)data;
+  char* const    path    = zix_path_join(NULL, dir, name);
+  if (zix_file_type(path) == ZIX_FILE_TYPE_DIRECTORY) {
+    lilv_watcher_add_bundle(watcher, path);
+  }
+
+  zix_free(NULL, path);
+}
+
+// Watch the directory at `dir_path` and every bundle in it
+static void
+watch_path_dir(void* const data, const char* const dir_path)
+{
+  Watcher* const watcher = (Watcher*)data;
+  char* const    path    = zix_expand_environment_strings(NULL, dir_path);
+  if (path && zix_file_type(path) == ZIX_FILE_TYPE_DIRECTORY) {
+    lilv_watcher_add_dir(watcher, path);
+    zix_dir_for_each(path, watcher, watch_bundle_entry);
+  }
+
+  zix_free(NULL, path);
+}
+
+int
+lilv_world_watch(LilvWorld* world)
+{
+  if (!world->watcher && !(world->watcher = lilv_watcher_new())) {
+    LILV_ERROR("Watching for changes is not supported\n");
+    return 1;
+  }
+
+  if (!world->changed_bundles) {
+    world->changed_bundles = lilv_node_hash_new(NULL);
+  }
+
+  for_each_path_dir(lilv_world_lv2_path(world), world->watcher, watch_path_dir);
+  return 0;
+}
+
+int
+lilv_world_get_watch_fd(const LilvWorld* world)
+{
+  return world->watcher ? lilv_watcher_fd(world->watcher) : -1;
+}
+
+// Append a bundle to the end of the change queue if it isn't already queued
+static void
+lilv_world_queue_change(LilvWorld* const world, const SordNode* const bundle)
+{
+  if (lilv_node_hash_find(world->changed_bundles, bundle) !=
+      lilv_node_hash_end(world->changed_bundles)) {
+    return; // Already queued
+  }
+
+  SordNode** const queue = (SordNode**)realloc(
+    world->change_queue, (world->n_queued_changes + 1U) * sizeof(SordNode*));
+
+  if (!queue || lilv_node_hash_insert_copy(world->changed_bundles, bundle)) {
+    world->change_queue = queue ? queue : world->change_queue;
+    world->lost_changes = true; // Fall back to rescanning everything
+    return;
+  }
+
+  // The queue refers to the (interned) node owned by the set
+  world->change_queue                            = queue;
+  world->change_queue[world->n_queued_changes++] = (SordNode*)bundle;
+}
+
+// Queue a bundle to be updated when changes are applied
+static void
+on_bundle_changed(void* const handle, const char* const bundle_path)
+{
+  LilvWorld* const world = (LilvWorld*)handle;
+  if (!bundle_path) {
+    world->lost_changes = true;
+    return;
+  }
+
+  LilvNode* const bundle = lilv_world_new_bundle_uri(world, bundle_path);
+  if (bundle) {
+    lilv_world_queue_change(world, bundle->node);
+  }
+
+  lilv_node_free(bundle);
+}
+
+unsigned
+lilv_world_apply_changes(LilvWorld* world)
+{
+  if (!world->watcher) {
+    return 0U;
+  }
+
+  allocate_model_if_necessary(world);
+
+  // Queue changes from any pending events
+  lilv_watcher_read(world->watcher, on_bundle_changed, world);
+
+  // Swap out the queue so it's empty for the next call
+  NodeHash* const  changed  = world->changed_bundles;
+  SordNode** const queue    = world->change_queue;
+  const unsigned   n_queued = world->n_queued_changes;
+  world->changed_bundles    = lilv_node_hash_new(NULL);
+  world->change_queue       = NULL;
+  world->n_queued_changes   = 0U;
+
+  unsigned n_changed = 0U;
+  if (world->lost_changes) {
+    // Events were lost, so scan everything and watch any new bundles
+    world->lost_changes = false;
+    for_each_path_dir(
+      lilv_world_lv2_path(world), world->watcher, watch_path_dir);
+
+    n_changed = lilv_world_rescan(world);
+  } else {
+    // Update changed bundles in order, reloading even if stamps are the same
+    for (unsigned i = 0U; i < n_queued; ++i) {
+      LilvNode* const bundle = lilv_node_new_from_node(world, queue[i]);
+
+      n_changed += lilv_world_update_bundle(world, bundle, true);
+      lilv_node_free(bundle);
+    }
+
+    // Load any new specifications and plugin classes
+    if (n_changed) {
+      lilv_world_load_specifications(world);
+      lilv_world_load_plugin_classes(world);
+    }
+  }
+
+  free(queue);
+  lilv_node_hash_free(changed, world->world);
+  return n_changed;
+}
+
+// Record that a file has been loaded so it isn't loaded again
+static void
+lilv_world_add_loaded_file(LilvWorld* const world, const SordNode* const uri)
+{
+  lilv_node_hash_insert_copy(world->loaded_files, uri);
+  lilv_file_index_add_file(world->file_index, world->world, uri);
+}
+
+static SerdStatus
+check_load_file(LilvWorld* const world, const SordNode* const uri)
+{
   assert(uri);
   if (lilv_node_hash_find(world->loaded_files, uri) !=
       lilv_node_hash_end(world->loaded_files)) {
@@ -1185,8 +2242,25 @@ lilv_world_load_file(LilvWorld* world, SerdReader* reader, const SordNode* uri)
     return SERD_FAILURE; // Not a Turtle file
   }
 
+  return SERD_SUCCESS;
+}
+
+SerdStatus
+lilv_world_load_file(LilvWorld* world, SerdReader* reader, const SordNode* uri)
+{
+  allocate_model_if_necessary(world);
+
+  SerdStatus st = check_load_file(world, uri);
+  if (st) {
+    return st;
+  }
+
+  const LoadStart start = lilv_world_begin_load(world);
+
   serd_reader_add_blank_prefix(reader, lilv_world_blank_node_prefix(world));
-  const SerdStatus st = serd_reader_read_file(reader, uri_str);
+  st = lilv_mapped_file_read(
+    reader, sord_node_get_string(uri), world->opt.mmap);
+  ++world->generation;
   if (st) {
     LILV_ERRORF("Error loading file <%s> (%s)\n",
                 sord_node_get_string(uri),
@@ -1194,7 +2268,79 @@ lilv_world_load_file(LilvWorld* world, SerdReader* reader, const SordNode* uri)
     return st;
   }
 
-  lilv_node_hash_insert_copy(world->loaded_files, uri);
+  lilv_world_end_load(world, uri, start, true);
+  lilv_world_add_loaded_file(world, uri);
+  return SERD_SUCCESS;
+}
+
+/**
+   Load a manifest or specification data file during discovery.
+
+   This is equivalent to lilv_world_load_file(), except it uses the discovery
+   cache if it's enabled, so an unchanged file is replayed from a snapshot
+   instead of being parsed again.
+*/
+static SerdStatus
+lilv_world_load_discovery_file(LilvWorld* const      world,
+                               LoadSkimmer* const    skimmer,
+                               const SordNode* const graph,
+                               const SordNode* const uri)
+{
+  if (!world->cache) {
+    return lilv_world_load_file(world, skimmer->reader, uri);
+  }
+
+  allocate_model_if_necessary(world);
+
+  SerdStatus st = check_load_file(world, uri);
+  if (st) {
+    return st;
+  }
+
+  // Get the current stamp of the file, or fall back to reading it normally
+  const char* const uri_str = (const char*)sord_node_get_string(uri);
+  char* const       path    = lilv_file_uri_parse(uri_str, NULL);
+  LilvFileStamp     stamp   = {0, 0U};
+  if (!path || lilv_file_stamp(path, &stamp)) {
+    lilv_free(path);
+    return lilv_world_load_file(world, skimmer->reader, uri);
+  }
+
+  lilv_free(path);
+
+  // Use a cached snapshot if the file hasn't changed, or read a new one
+  const LoadStart start    = lilv_world_begin_load(world);
+  const Snapshot* snapshot = lilv_cache_find(world->cache, uri, &stamp);
+  const bool      parsed   = !snapshot;
+  if (!snapshot) {
+    Snapshot* const fresh = snapshot_new();
+    if (!fresh) {
+      return SERD_ERR_INTERNAL;
+    }
+
+    const SerdNode* const base = serd_env_get_base_uri(skimmer->env, NULL);
+    snapshot_read_file(
+      fresh, base, (const uint8_t*)uri_str, world->opt.mmap);
+
+    lilv_cache_insert(world->cache, uri, &stamp, fresh);
+    if (!(snapshot = lilv_cache_find(world->cache, uri, &stamp))) {
+      return SERD_ERR_INTERNAL;
+    }
+  }
+
+  // Insert the statements into the model just as if they were read
+  st = snapshot_replay(
+    snapshot, skimmer, graph, lilv_world_blank_node_prefix(world));
+  ++world->generation;
+  if (st) {
+    LILV_ERRORF("Error loading file <%s> (%s)\n",
+                sord_node_get_string(uri),
+                serd_strerror(st));
+    return st;
+  }
+
+  lilv_world_end_load(world, uri, start, parsed);
+  lilv_world_add_loaded_file(world, uri);
   return SERD_SUCCESS;
 }
 
@@ -1253,6 +2399,8 @@ lilv_world_unload_resource(LilvWorld* world, const LilvNode* resource)
                   sord_node_get_string(file));
     } else if (!lilv_world_drop_graph(world, file_node->node)) {
       lilv_node_hash_remove(world->loaded_files, world->world, file_node->node);
+      lilv_file_index_remove_file(
+        world->file_index, world->world, file_node->node);
       ++n_dropped;
     }
     lilv_node_free(file_node);
@@ -1262,6 +2410,92 @@ lilv_world_unload_resource(LilvWorld* world, const LilvNode* resource)
   return n_dropped;
 }
 
+int
+lilv_world_get_stats(const LilvWorld* world, LilvWorldStats* stats)
+{
+  *stats = world->stats;
+  return !world->opt.stats;
+}
+
+typedef struct {
+  LilvWorld*        world;
+  LilvLoadStatsFunc func;
+  void*             user_data;
+} StatsVisitor;
+
+static void
+visit_stats(void* const                handle,
+            const SordNode* const      uri,
+            const LilvLoadStats* const stats)
+{
+  const StatsVisitor* const visitor = (const StatsVisitor*)handle;
+  LilvNode* const           node = lilv_node_new_from_node(visitor->world, uri);
+
+  visitor->func(visitor->user_data, node, stats);
+  lilv_node_free(node);
+}
+
+void
+lilv_world_get_bundle_stats(const LilvWorld*  world,
+                            LilvLoadStatsFunc func,
+                            void*             user_data)
+{
+  if (world->bundle_stats) {
+    StatsVisitor visitor = {(LilvWorld*)world, func, user_data};
+    lilv_stats_hash_visit(world->bundle_stats, visit_stats, &visitor);
+  }
+}
+
+void
+lilv_world_get_file_stats(const LilvWorld*  world,
+                          LilvLoadStatsFunc func,
+                          void*             user_data)
+{
+  if (world->file_stats) {
+    StatsVisitor visitor = {(LilvWorld*)world, func, user_data};
+    lilv_stats_hash_visit(world->file_stats, visit_stats, &visitor);
+  }
+}
+
+LilvPlugins*
+lilv_world_get_supported_plugins(LilvWorld* const            world,
+                                 const LilvFeatureSet* const features)
+{
+  LilvPlugins* const result = lilv_plugins_new();
+
+  LILV_FOREACH (plugins, i, world->plugins) {
+    const LilvPlugin* const plugin = lilv_plugins_get(world->plugins, i);
+    if (lilv_plugin_is_supported(plugin, features)) {
+      lilv_collection_insert(result, (LilvPlugin*)plugin);
+    }
+  }
+
+  return result;
+}
+
+LilvSearchResult*
+lilv_world_search_plugins(LilvWorld* const  world,
+                          const char* const query,
+                          const uint32_t    flags,
+                          unsigned* const   n_results)
+{
+  if (!world->search_index) {
+    // Build the index on the first search, then keep it up to date
+    if (!(world->search_index = lilv_search_index_new())) {
+      *n_results = 0U;
+      return NULL;
+    }
+
+    LILV_FOREACH (plugins, i, world->plugins) {
+      lilv_search_index_add(world->search_index,
+                            lilv_plugins_get(world->plugins, i));
+    }
+  }
+
+  return lilv_search_index_search(
+    world->search_index, world, query, flags, n_results);
+}
+
 const LilvPluginClass*
 lilv_world_get_plugin_class(const LilvWorld* world)
 {
@@ -1271,6 +2505,7 @@ lilv_world_get_plugin_class(const LilvWorld* world)
 const LilvPluginClasses*
 lilv_world_get_plugin_classes(const LilvWorld* world)
 {
+  lilv_world_update_plugin_classes((LilvWorld*)world);
   return world->plugin_classes;
 }
 
@@ -1280,9 +2515,24 @@ lilv_world_get_all_plugins(const LilvWorld* world)
   return world->plugins;
 }
 
+const LilvPlugin*
+lilv_world_get_plugin_by_uri(const LilvWorld* world, const char* uri)
+{
+  SordNode* const   node   = sord_new_uri(world->world, (const uint8_t*)uri);
+  const LilvPlugin* plugin = NULL;
+  if (node) {
+    plugin = lilv_plugin_hash_find(world->plugin_index, node);
+    sord_node_free(world->world, node);
+  }
+
+  return plugin;
+}
+
 LilvNode*
 lilv_world_get_symbol(LilvWorld* world, const LilvNode* subject)
 {
+  lilv_world_load_specs_for(world, subject->node, NULL, NULL);
+
   // Check for explicitly given symbol
   SordNode* snode =
     sord_get(world->model, subject->node, world->uris.lv2_symbol, NULL, NULL);
@@ -0,0 +1,137 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Benchmark for loading data files with and without mmap.
+
+  This writes a synthetic LV2 path with many small bundles, then times loading
+  the world and every plugin's data with LILV_OPTION_MMAP disabled and enabled.
+*/
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const char* const manifest_ttl = "\
+:plug%u a lv2:Plugin ;\n\
+	lv2:binary <plugin" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const plugin_head_ttl = "\
+:plug%u a lv2:Plugin ;\n\
+	doap:name \"Plugin %u\" ;\n\
+	lv2:optionalFeature lv2:hardRTCapable ;\n\
+	lv2:port";
+
+static const char* const plugin_port_ttl = "%s [\n\
+		a lv2:InputPort , lv2:ControlPort ;\n\
+		lv2:index %u ;\n\
+		lv2:symbol \"port%u\" ;\n\
+		lv2:name \"Port %u\" ;\n\
+		lv2:default 0.5 ;\n\
+		lv2:minimum 0.0 ;\n\
+		lv2:maximum 1.0\n\
+	]";
+
+static const unsigned n_ports = 8U;
+static const unsigned n_runs  = 5U;
+
+static void
+add_bundle(LilvTestPath* const path, const unsigned index)
+{
+  char name[32];
+  char manifest[256];
+  char plugin[4096];
+  snprintf(name, sizeof(name), "plug%05u.lv2", index);
+  snprintf(manifest, sizeof(manifest), manifest_ttl, index);
+
+  size_t len = (size_t)snprintf(
+    plugin, sizeof(plugin), plugin_head_ttl, index, index);
+  for (unsigned i = 0U; i < n_ports; ++i) {
+    len += (size_t)snprintf(plugin + len,
+                            sizeof(plugin) - len,
+                            plugin_port_ttl,
+                            i ? " ," : "",
+                            i,
+                            i,
+                            i);
+    assert(len < sizeof(plugin));
+  }
+
+  snprintf(plugin + len, sizeof(plugin) - len, " .\n");
+
+  add_test_bundle(path, name, manifest, plugin);
+}
+
+static double
+elapsed_s(const struct timespec* const start, const struct timespec* const end)
+{
+  return (double)(end->tv_sec - start->tv_sec) +
+         ((double)(end->tv_nsec - start->tv_nsec) * 0.000000001);
+}
+
+/// Load the world and the data of every plugin, and return the time taken
+static double
+load(const LilvTestPath* const path,
+     const unsigned            n_bundles,
+     const bool                mmap)
+{
+  struct timespec start = {0, 0};
+  struct timespec end   = {0, 0};
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  LilvWorld* const world = lilv_test_path_world(path);
+  set_test_option(world, LILV_OPTION_MMAP, lilv_new_bool(world, mmap));
+  set_test_option(world, LILV_OPTION_OBJECT_INDEX, lilv_new_bool(world, false));
+  lilv_world_load_all(world);
+
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  assert(lilv_plugins_size(plugins) == n_bundles);
+  LILV_FOREACH (plugins, i, plugins) {
+    const LilvPlugin* const plugin = lilv_plugins_get(plugins, i);
+    assert(lilv_plugin_get_num_ports(plugin) == n_ports);
+  }
+
+  lilv_world_free(world);
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  return elapsed_s(&start, &end);
+}
+
+int
+main(int argc, char** argv)
+{
+  const unsigned n_bundles =
+    (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 10) : 2000U;
+
+  LilvTestPath* const path = lilv_test_path_new(false);
+  for (unsigned i = 0U; i < n_bundles; ++i) {
+    add_bundle(path, i);
+  }
+
+  // Alternate between modes and take the best of several runs of each
+  double best_read = 0.0;
+  double best_mmap = 0.0;
+  for (unsigned r = 0U; r < n_runs; ++r) {
+    const double read_s = load(path, n_bundles, false);
+    const double mmap_s = load(path, n_bundles, true);
+
+    best_read = (!r || read_s < best_read) ? read_s : best_read;
+    best_mmap = (!r || mmap_s < best_mmap) ? mmap_s : best_mmap;
+  }
+
+  printf("# Bundles\tRead (s)\tMmap (s)\n");
+  printf("%u\t%f\t%f\n", n_bundles, best_read, best_mmap);
+
+  lilv_test_path_free(path);
+  return 0;
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Benchmark for loading the ports of a plugin with very many ports.
+
+  This writes a bundle with a single plugin that has thousands of control
+  ports, then times the first access of the plugin's ports, after its data has
+  already been loaded.
+*/
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const char* const plugin_head_ttl = "\
+:plug a lv2:Plugin ;\n\
+	doap:name \"Big plugin\" ;\n\
+	lv2:port";
+
+static const char* const plugin_port_ttl = "%s [\n\
+		a lv2:InputPort , lv2:ControlPort ;\n\
+		lv2:index %u ;\n\
+		lv2:symbol \"port%u\" ;\n\
+		lv2:name \"Port %u\" ;\n\
+		lv2:portProperty lv2:integer ;\n\
+		lv2:default 1 ;\n\
+		lv2:minimum 0 ;\n\
+		lv2:maximum 127\n\
+	]";
+
+static const unsigned n_runs = 5U;
+
+static void
+write_plugin(const char* const path, const unsigned n_ports)
+{
+  FILE* const file = fopen(path, "w");
+  assert(file);
+
+  fprintf(file, "%s", PLUGIN_PREFIXES);
+  fprintf(file, "%s", plugin_head_ttl);
+  for (unsigned i = 0U; i < n_ports; ++i) {
+    fprintf(file, plugin_port_ttl, i ? " ," : "", i, i, i);
+  }
+  fprintf(file, " .\n");
+  fclose(file);
+}
+
+static double
+elapsed_s(const struct timespec* const start, const struct timespec* const end)
+{
+  return (double)(end->tv_sec - start->tv_sec) +
+         ((double)(end->tv_nsec - start->tv_nsec) * 0.000000001);
+}
+
+/// Load the plugin data, then return the time taken to load its ports
+static double
+load_ports(const LilvTestPath* const path, const unsigned n_ports)
+{
+  LilvWorld* const world = lilv_test_path_world(path);
+  lilv_world_load_all(world);
+
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  assert(lilv_plugins_size(plugins) == 1U);
+
+  const LilvPlugin* const plugin =
+    lilv_plugins_get(plugins, lilv_plugins_begin(plugins));
+
+  LilvNode* const name = lilv_plugin_get_name(plugin);
+  assert(name);
+
+  struct timespec start = {0, 0};
+  struct timespec end   = {0, 0};
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  assert(lilv_plugin_get_num_ports(plugin) == n_ports);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  lilv_node_free(name);
+  lilv_world_free(world);
+  return elapsed_s(&start, &end);
+}
+
+int
+main(int argc, char** argv)
+{
+  const unsigned n_ports =
+    (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 10) : 4096U;
+
+  LilvTestPath* const         path = lilv_test_path_new(false);
+  const LilvTestBundle* const bundle =
+    add_test_bundle(path, "big.lv2", SIMPLE_MANIFEST_TTL, "");
+
+  write_plugin(bundle->plugin_path, n_ports);
+
+  // Take the best of several runs
+  double best = 0.0;
+  for (unsigned r = 0U; r < n_runs; ++r) {
+    const double t = load_ports(path, n_ports);
+
+    best = (!r || t < best) ? t : best;
+  }
+
+  printf("# Ports\tLoad ports (s)\n");
+  printf("%u\t%f\n", n_ports, best);
+
+  lilv_test_path_free(path);
+  return 0;
+}
@@ -18,6 +18,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _WIN32
+#  define PATH_SEP ";"
+#else
+#  define PATH_SEP ":"
+#endif
+
 LilvTestEnv*
 lilv_test_env_new(void)
 {
@@ -174,6 +180,148 @@ delete_bundle(LilvTestEnv* env)
   env->test_bundle_path   = NULL;
 }
 
+void
+write_test_file(const char* const path,
+                const char* const prefix,
+                const char* const body)
+{
+  FILE* const file = fopen(path, "w");
+  assert(file);
+  fprintf(file, "%s%s", prefix, body);
+  fclose(file);
+}
+
+LilvTestBundle
+write_test_bundle(const char* const dir,
+                  const char* const name,
+                  const char* const manifest,
+                  const char* const plugin)
+{
+  LilvTestBundle    bundle = {zix_path_join(NULL, dir, name), NULL, NULL};
+  const char* const path   = bundle.bundle_path;
+
+  bundle.manifest_path = zix_path_join(NULL, path, "manifest.ttl");
+  bundle.plugin_path   = zix_path_join(NULL, path, "plugin.ttl");
+
+  assert(!zix_create_directories(NULL, path));
+  write_test_file(bundle.manifest_path, MANIFEST_PREFIXES, manifest);
+  write_test_file(bundle.plugin_path, PLUGIN_PREFIXES, plugin);
+  return bundle;
+}
+
+void
+remove_test_bundle(LilvTestBundle* const bundle)
+{
+  if (bundle->bundle_path) {
+    zix_remove(bundle->plugin_path);
+    zix_remove(bundle->manifest_path);
+    zix_remove(bundle->bundle_path);
+  }
+
+  zix_free(NULL, bundle->plugin_path);
+  zix_free(NULL, bundle->manifest_path);
+  zix_free(NULL, bundle->bundle_path);
+
+  bundle->plugin_path   = NULL;
+  bundle->manifest_path = NULL;
+  bundle->bundle_path   = NULL;
+}
+
+LilvNode*
+test_bundle_uri(LilvWorld* const world, const LilvTestBundle* const bundle)
+{
+  char* const     path = zix_path_join(NULL, bundle->bundle_path, NULL);
+  LilvNode* const uri  = lilv_new_file_uri(world, NULL, path);
+
+  zix_free(NULL, path);
+  return uri;
+}
+
+LilvTestPath*
+lilv_test_path_new(const bool specs)
+{
+  LilvTestPath* const path = (LilvTestPath*)calloc(1, sizeof(LilvTestPath));
+  assert(path);
+
+  path->top = lilv_create_temporary_directory("lilv_XXXXXX");
+  assert(path->top);
+
+  if (specs) {
+    // Put the test specifications first so that classes are available
+    char* const test_dir = zix_canonical_path(NULL, LILV_TEST_DIR);
+    char* const spec_dir = zix_path_join(NULL, test_dir, "lv2");
+    char* const head     = string_concat(spec_dir, PATH_SEP);
+
+    path->lv2_path = string_concat(head, path->top);
+
+    free(head);
+    zix_free(NULL, spec_dir);
+    zix_free(NULL, test_dir);
+  } else {
+    path->lv2_path = string_concat(path->top, "");
+  }
+
+  return path;
+}
+
+void
+lilv_test_path_free(LilvTestPath* const path)
+{
+  for (unsigned i = 0U; i < path->n_bundles; ++i) {
+    remove_test_bundle(path->bundles[i]);
+    free(path->bundles[i]);
+  }
+
+  remove_temporary(path->top);
+
+  free(path->bundles);
+  free(path->lv2_path);
+  zix_free(NULL, path->top);
+  free(path);
+}
+
+LilvTestBundle*
+add_test_bundle(LilvTestPath* const path,
+                const char* const   name,
+                const char* const   manifest,
+                const char* const   plugin)
+{
+  LilvTestBundle** const bundles = (LilvTestBundle**)realloc(
+    path->bundles, (path->n_bundles + 1U) * sizeof(LilvTestBundle*));
+  assert(bundles);
+
+  LilvTestBundle* const bundle =
+    (LilvTestBundle*)calloc(1, sizeof(LilvTestBundle));
+  assert(bundle);
+
+  *bundle = write_test_bundle(path->top, name, manifest, plugin);
+
+  path->bundles                    = bundles;
+  path->bundles[path->n_bundles++] = bundle;
+  return bundle;
+}
+
+LilvWorld*
+lilv_test_path_world(const LilvTestPath* const path)
+{
+  LilvWorld* const world = lilv_world_new();
+  assert(world);
+
+  set_test_option(
+    world, LILV_OPTION_LV2_PATH, lilv_new_string(world, path->lv2_path));
+
+  return world;
+}
+
+void
+set_test_option(LilvWorld* const  world,
+                const char* const uri,
+                LilvNode* const   value)
+{
+  lilv_world_set_option(world, uri, value);
+  lilv_node_free(value);
+}
+
 void
 set_env(const char* name, const char* value)
 {
@@ -7,6 +7,8 @@
 #include <lilv/lilv.h>
 #include <zix/attributes.h>
 
+#include <stdbool.h>
+
 #define MANIFEST_PREFIXES \
   "\
 @prefix : <http://example.org/> .\n\
@@ -76,6 +78,63 @@ start_bundle(LilvTestEnv* env,
 void
 delete_bundle(LilvTestEnv* env);
 
+// Paths of a bundle written to a directory with write_test_bundle()
+typedef struct {
+  char* bundle_path;   ///< Bundle directory
+  char* manifest_path; ///< Manifest file in bundle
+  char* plugin_path;   ///< Plugin data file in bundle
+} LilvTestBundle;
+
+// Write a file that contains a prefix followed by a body
+void
+write_test_file(const char* path, const char* prefix, const char* body);
+
+// Write a bundle with a manifest and plugin file in an arbitrary directory
+LilvTestBundle
+write_test_bundle(const char* dir,
+                  const char* name,
+                  const char* manifest,
+                  const char* plugin);
+
+// Remove a bundle written with write_test_bundle() and free its paths
+void
+remove_test_bundle(LilvTestBundle* bundle);
+
+// Return the URI of a bundle written with write_test_bundle()
+LilvNode*
+test_bundle_uri(LilvWorld* world, const LilvTestBundle* bundle);
+
+// A temporary directory in the LV2 path for tests that write several bundles
+typedef struct {
+  char*            top;       ///< Temporary directory that bundles are in
+  char*            lv2_path;  ///< LV2 path that includes `top`
+  LilvTestBundle** bundles;   ///< Bundles written with add_test_bundle()
+  unsigned         n_bundles; ///< Number of elements in bundles
+} LilvTestPath;
+
+// Create a temporary LV2 path, after the test specifications if `specs` is set
+LilvTestPath*
+lilv_test_path_new(bool specs);
+
+// Remove every bundle in a temporary LV2 path and the directory, then free it
+void
+lilv_test_path_free(LilvTestPath* path);
+
+// Write a bundle to a temporary LV2 path (which owns and removes it)
+LilvTestBundle*
+add_test_bundle(LilvTestPath* path,
+                const char*   name,
+                const char*   manifest,
+                const char*   plugin);
+
+// Create a world that uses a temporary LV2 path, without loading anything
+LilvWorld*
+lilv_test_path_world(const LilvTestPath* path);
+
+// Set an option on a world, then free the value
+void
+set_test_option(LilvWorld* world, const char* uri, LilvNode* value);
+
 // Set an environment variable so it is immediately visible in this process
 void
 set_env(const char* name, const char* value);
@@ -0,0 +1,187 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+#include <zix/allocator.h>
+#include <zix/filesystem.h>
+#include <zix/path.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char* const manifest_ttl = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const new_manifest_ttl = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n\
+:foobar a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const plugin_ttl = "\
+:plug a lv2:Plugin ;\n\
+	doap:name \"Cached plugin\" .\n\
+:foobar a lv2:Plugin ;\n\
+	doap:name \"Other plugin\" .\n";
+
+typedef struct {
+  LilvTestPath*   path;
+  LilvTestBundle* bundle;
+  char*           cache_dir;
+  char*           cache_path;
+} CacheTest;
+
+static CacheTest
+setup(void)
+{
+  CacheTest test = {lilv_test_path_new(true), NULL, NULL, NULL};
+
+  test.bundle =
+    add_test_bundle(test.path, "cache.lv2", manifest_ttl, plugin_ttl);
+
+  test.cache_dir  = lilv_create_temporary_directory("lilv_cache_XXXXXX");
+  test.cache_path = zix_path_join(NULL, test.cache_dir, "discovery.cache");
+  return test;
+}
+
+static void
+teardown(CacheTest* const test)
+{
+  zix_remove(test->cache_path);
+  zix_remove(test->cache_dir);
+  zix_free(NULL, test->cache_path);
+  zix_free(NULL, test->cache_dir);
+  lilv_test_path_free(test->path);
+}
+
+static LilvWorld*
+load_world(const CacheTest* const test)
+{
+  LilvWorld* const world = lilv_test_path_world(test->path);
+
+  set_test_option(
+    world, LILV_OPTION_CACHE_DIR, lilv_new_string(world, test->cache_dir));
+  set_test_option(world, LILV_OPTION_STATS, lilv_new_bool(world, true));
+  lilv_world_load_all(world);
+  return world;
+}
+
+static void
+check_plugin(LilvWorld* const world, const char* const uri, const char* name)
+{
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugin* const  plugin  = lilv_plugins_get_by_uri(plugins, node);
+  assert(plugin);
+
+  LilvNode* const plugin_name = lilv_plugin_get_name(plugin);
+  assert(!strcmp(lilv_node_as_string(plugin_name), name));
+
+  lilv_node_free(plugin_name);
+  lilv_node_free(node);
+}
+
+static LilvLoadStats
+load_stats(const LilvWorld* const world)
+{
+  LilvWorldStats stats;
+  assert(!lilv_world_get_stats(world, &stats));
+  return stats.total;
+}
+
+static unsigned
+num_classes(const LilvWorld* const world)
+{
+  return lilv_plugin_classes_size(lilv_world_get_plugin_classes(world));
+}
+
+static void
+test_cold_and_warm(void)
+{
+  CacheTest test = setup();
+
+  // Cold start, which should write the cache
+  LilvWorld* const    cold       = load_world(&test);
+  const LilvLoadStats cold_stats = load_stats(cold);
+  assert(zix_file_type(test.cache_path) == ZIX_FILE_TYPE_REGULAR);
+  assert(cold_stats.n_files > 0U);
+  assert(cold_stats.n_bytes > 0U);
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(cold)) == 1U);
+  check_plugin(cold, "http://example.org/plug", "Cached plugin");
+
+  // Warm start, which should load exactly the same data from the cache
+  LilvWorld* const    warm       = load_world(&test);
+  const LilvLoadStats warm_stats = load_stats(warm);
+  assert(warm_stats.n_files == cold_stats.n_files);
+  assert(!warm_stats.n_bytes); // Every file was replayed without parsing
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(warm)) == 1U);
+  assert(num_classes(warm) == num_classes(cold));
+  assert(num_classes(warm) > 1U);
+  check_plugin(warm, "http://example.org/plug", "Cached plugin");
+
+  lilv_world_free(warm);
+  lilv_world_free(cold);
+  teardown(&test);
+}
+
+static void
+test_changed_manifest(void)
+{
+  CacheTest test = setup();
+
+  LilvWorld* const before = load_world(&test);
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(before)) == 1U);
+  lilv_world_free(before);
+
+  // Change the manifest (which also changes its size)
+  write_test_file(
+    test.bundle->manifest_path, MANIFEST_PREFIXES, new_manifest_ttl);
+
+  LilvWorld* const after = load_world(&test);
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(after)) == 2U);
+  check_plugin(after, "http://example.org/plug", "Cached plugin");
+  check_plugin(after, "http://example.org/foobar", "Other plugin");
+  lilv_world_free(after);
+
+  teardown(&test);
+}
+
+static void
+test_invalid_cache(void)
+{
+  CacheTest test = setup();
+
+  // Write garbage to the cache file, which should be ignored
+  write_test_file(test.cache_path, "LILVDSC", "garbage");
+
+  LilvWorld* const world = load_world(&test);
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(world)) == 1U);
+  check_plugin(world, "http://example.org/plug", "Cached plugin");
+  lilv_world_free(world);
+
+  // The invalid cache should have been replaced with a valid one
+  LilvWorld* const warm = load_world(&test);
+  assert(lilv_plugins_size(lilv_world_get_all_plugins(warm)) == 1U);
+  lilv_world_free(warm);
+
+  teardown(&test);
+}
+
+int
+main(void)
+{
+  test_cold_and_warm();
+  test_changed_manifest();
+  test_invalid_cache();
+
+  return 0;
+}
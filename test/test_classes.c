@@ -6,6 +6,7 @@
 #include "lilv_test_utils.h"
 
 #include <lilv/lilv.h>
+#include <lv2/core/lv2.h>
 
 #include <assert.h>
 #include <string.h>
@@ -55,10 +56,60 @@ main(void)
       lilv_plugin_class_get_uri(plugin)));
   }
 
+  // Classes can be accessed by index in order of URI
+  const unsigned n_classes = lilv_plugin_classes_size(classes);
+  for (unsigned i = 1U; i < n_classes; ++i) {
+    const LilvPluginClass* const prev =
+      lilv_plugin_classes_get_at(classes, i - 1U);
+    const LilvPluginClass* const klass = lilv_plugin_classes_get_at(classes, i);
+    assert(strcmp(lilv_node_as_uri(lilv_plugin_class_get_uri(prev)),
+                  lilv_node_as_uri(lilv_plugin_class_get_uri(klass))) < 0);
+  }
+  assert(!lilv_plugin_classes_get_at(classes, n_classes));
+
   LilvNode* some_uri = lilv_new_uri(world, "http://example.org/whatever");
   assert(lilv_plugin_classes_get_by_uri(classes, some_uri) == NULL);
   lilv_node_free(some_uri);
 
+  LilvNode* dynamics_uri   = lilv_new_uri(world, LV2_CORE__DynamicsPlugin);
+  LilvNode* compressor_uri = lilv_new_uri(world, LV2_CORE__CompressorPlugin);
+
+  const LilvPluginClass* const dynamics =
+    lilv_plugin_classes_get_by_uri(classes, dynamics_uri);
+  const LilvPluginClass* const compressor =
+    lilv_plugin_classes_get_by_uri(classes, compressor_uri);
+
+  assert(dynamics);
+  assert(compressor);
+
+  // Subclass checks are transitive and reflexive
+  assert(lilv_plugin_class_is_a(compressor, compressor));
+  assert(lilv_plugin_class_is_a(compressor, dynamics));
+  assert(lilv_plugin_class_is_a(compressor, plugin));
+  assert(lilv_plugin_class_is_a(dynamics, plugin));
+  assert(!lilv_plugin_class_is_a(dynamics, compressor));
+  assert(!lilv_plugin_class_is_a(plugin, dynamics));
+
+  LilvPluginClasses* const dynamics_children =
+    lilv_plugin_class_get_children(dynamics);
+  assert(lilv_plugin_classes_size(dynamics_children) == 1);
+  assert(lilv_plugin_classes_get_by_uri(dynamics_children, compressor_uri));
+  lilv_plugin_classes_free(dynamics_children);
+
+  // Plugins are instances of all ancestors of their types
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plug =
+    lilv_plugins_get_by_uri(plugins, env->plugin1_uri);
+
+  assert(plug);
+  assert(lilv_plugin_get_class(plug) == compressor);
+  assert(lilv_plugin_is_a(plug, compressor));
+  assert(lilv_plugin_is_a(plug, dynamics));
+  assert(lilv_plugin_is_a(plug, plugin));
+
+  lilv_node_free(compressor_uri);
+  lilv_node_free(dynamics_uri);
+
   lilv_plugin_classes_free(children);
   delete_bundle(env);
   lilv_test_env_free(env);
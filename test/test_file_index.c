@@ -0,0 +1,168 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char* const a_manifest = "\
+:a a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const a_plugin = "\
+:a doap:name \"Alpha\" .\n";
+
+static const char* const b_manifest = "\
+:b a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const b_plugin = "\
+:b doap:name \"Beta\" .\n";
+
+static const char* const changed_b_plugin = "\
+:b doap:name \"Changed beta\" .\n";
+
+// A plugin that also has data in the plugin file of bundle B
+static const char* const c_manifest = "\
+:c a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> ,\n\
+		<../b.lv2/plugin.ttl> .\n";
+
+static const char* const c_plugin = "\
+:c doap:name \"Gamma\" .\n";
+
+static bool
+has_plugin(LilvWorld* const world, const char* const uri)
+{
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const bool result = lilv_plugins_get_by_uri(plugins, node) != NULL;
+
+  lilv_node_free(node);
+  return result;
+}
+
+static bool
+plugin_has_name(LilvWorld* const   world,
+                const char* const uri,
+                const char* const name)
+{
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin  = lilv_plugins_get_by_uri(plugins, node);
+  LilvNode* const          value   = lilv_plugin_get_name(plugin);
+  const bool result = value && !strcmp(lilv_node_as_string(value), name);
+
+  lilv_node_free(value);
+  lilv_node_free(node);
+  return result;
+}
+
+static void
+test_remove_bundle(void)
+{
+  LilvTestPath* const   path = lilv_test_path_new(false);
+  LilvTestBundle* const a =
+    add_test_bundle(path, "a.lv2", a_manifest, a_plugin);
+  const LilvTestBundle* const b =
+    add_test_bundle(path, "b.lv2", b_manifest, b_plugin);
+
+  LilvWorld* const world = lilv_test_path_world(path);
+  lilv_world_load_all(world);
+  assert(plugin_has_name(world, "http://example.org/a", "Alpha"));
+  assert(plugin_has_name(world, "http://example.org/b", "Beta"));
+
+  // Removing bundle A doesn't affect the files loaded from bundle B
+  remove_test_bundle(a);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(!has_plugin(world, "http://example.org/a"));
+  assert(plugin_has_name(world, "http://example.org/b", "Beta"));
+
+  // So changes to the data files in bundle B are still detected
+  write_test_file(b->plugin_path, PLUGIN_PREFIXES, changed_b_plugin);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(plugin_has_name(world, "http://example.org/b", "Changed beta"));
+  assert(!lilv_world_rescan(world));
+
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+static void
+test_reload_bundle(void)
+{
+  LilvTestPath* const         path = lilv_test_path_new(false);
+  const LilvTestBundle* const a =
+    add_test_bundle(path, "a.lv2", a_manifest, a_plugin);
+
+  LilvWorld* const world = lilv_test_path_world(path);
+  LilvNode* const  a_uri = test_bundle_uri(world, a);
+
+  lilv_world_load_bundle(world, a_uri);
+  assert(plugin_has_name(world, "http://example.org/a", "Alpha"));
+
+  // Unloading a bundle forgets its files, so they're read again after reload
+  assert(!lilv_world_unload_bundle(world, a_uri));
+  lilv_world_load_bundle(world, a_uri);
+  assert(plugin_has_name(world, "http://example.org/a", "Alpha"));
+
+  // Which works the same way any number of times
+  assert(!lilv_world_unload_bundle(world, a_uri));
+  lilv_world_load_bundle(world, a_uri);
+  assert(plugin_has_name(world, "http://example.org/a", "Alpha"));
+
+  lilv_node_free(a_uri);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+static void
+test_orphans(void)
+{
+  LilvTestPath* const         path = lilv_test_path_new(false);
+  const LilvTestBundle* const b =
+    add_test_bundle(path, "b.lv2", b_manifest, b_plugin);
+  const LilvTestBundle* const c =
+    add_test_bundle(path, "c.lv2", c_manifest, c_plugin);
+
+  LilvWorld* const world = lilv_test_path_world(path);
+  LilvNode* const  b_uri = test_bundle_uri(world, b);
+  LilvNode* const  c_uri = test_bundle_uri(world, c);
+
+  // Load the plugin file of bundle B before that bundle is loaded
+  lilv_world_load_bundle(world, c_uri);
+  assert(plugin_has_name(world, "http://example.org/c", "Gamma"));
+
+  // Load bundle B, then unload both
+  lilv_world_load_bundle(world, b_uri);
+  assert(!lilv_world_unload_bundle(world, c_uri));
+  assert(!lilv_world_unload_bundle(world, b_uri));
+
+  // Unloading bundle B forgot the file, so it is read again after reload
+  lilv_world_load_bundle(world, b_uri);
+  assert(plugin_has_name(world, "http://example.org/b", "Beta"));
+
+  lilv_node_free(c_uri);
+  lilv_node_free(b_uri);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+int
+main(void)
+{
+  test_remove_bundle();
+  test_reload_bundle();
+  test_orphans();
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char* const manifest_ttl = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const plugin_ttl = "\
+:plug a lv2:Plugin ;\n\
+	doap:name \"Plug\" ;\n\
+	lv2:port [\n\
+		a lv2:InputPort ,\n\
+			lv2:ControlPort ;\n\
+		lv2:index 0 ;\n\
+		lv2:symbol \"in\" ;\n\
+		lv2:name \"In\" ;\n\
+		lv2:portProperty lv2:toggled\n\
+	] .\n";
+
+/// Load the test specifications lazily, and any bundles in `path`
+static LilvWorld*
+load_lazy_world(const LilvTestPath* const path)
+{
+  LilvWorld* const world = lilv_test_path_world(path);
+
+  set_test_option(
+    world, LILV_OPTION_LAZY_SPECIFICATIONS, lilv_new_bool(world, true));
+
+  lilv_world_load_all(world);
+  return world;
+}
+
+static bool
+has_owl_classes(LilvWorld* const world)
+{
+  LilvNode* const rdf_type  = lilv_new_uri(world, LILV_NS_RDF "type");
+  LilvNode* const owl_class = lilv_new_uri(world, LILV_NS_OWL "Class");
+  const bool      result    = lilv_world_ask(world, NULL, rdf_type, owl_class);
+
+  lilv_node_free(owl_class);
+  lilv_node_free(rdf_type);
+  return result;
+}
+
+static void
+test_query(void)
+{
+  LilvTestPath* const path  = lilv_test_path_new(true);
+  LilvWorld* const    world = load_lazy_world(path);
+
+  // Nothing in the spec namespace has been queried, so it's not loaded
+  assert(!has_owl_classes(world));
+
+  // Querying a subject in the spec namespace loads it
+  LilvNode* const lv2_Plugin = lilv_new_uri(world, LILV_NS_LV2 "Plugin");
+  LilvNode* const rdfs_label = lilv_new_uri(world, LILV_NS_RDFS "label");
+
+  LilvNode* const label = lilv_world_get(world, lv2_Plugin, rdfs_label, NULL);
+  assert(label);
+  assert(!strcmp(lilv_node_as_string(label), "Plugin"));
+  assert(has_owl_classes(world));
+
+  lilv_node_free(label);
+  lilv_node_free(rdfs_label);
+  lilv_node_free(lv2_Plugin);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+static void
+test_plugin_classes(void)
+{
+  LilvTestPath* const path  = lilv_test_path_new(true);
+  LilvWorld* const    world = load_lazy_world(path);
+  assert(!has_owl_classes(world));
+
+  // Getting plugin classes loads every specification
+  const LilvPluginClasses* const classes = lilv_world_get_plugin_classes(world);
+  assert(lilv_plugin_classes_size(classes) > 1U);
+  assert(has_owl_classes(world));
+
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+static void
+test_class_children(void)
+{
+  LilvTestPath* const path  = lilv_test_path_new(true);
+  LilvWorld* const    world = load_lazy_world(path);
+  assert(!has_owl_classes(world));
+
+  // Getting the children of the root class loads every specification
+  const LilvPluginClass* const root     = lilv_world_get_plugin_class(world);
+  LilvPluginClasses* const     children = lilv_plugin_class_get_children(root);
+  assert(lilv_plugin_classes_size(children) > 0U);
+  assert(has_owl_classes(world));
+
+  lilv_plugin_classes_free(children);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+static void
+test_port_accessor(void)
+{
+  LilvTestPath* const path = lilv_test_path_new(true);
+  add_test_bundle(path, "plug.lv2", manifest_ttl, plugin_ttl);
+
+  LilvWorld* const world = load_lazy_world(path);
+  assert(!has_owl_classes(world));
+
+  LilvNode* const plug_uri = lilv_new_uri(world, "http://example.org/plug");
+  LilvNode* const lv2_portProperty =
+    lilv_new_uri(world, LILV_NS_LV2 "portProperty");
+
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin  = lilv_plugins_get_by_uri(plugins, plug_uri);
+  assert(plugin);
+
+  const LilvPort* const port = lilv_plugin_get_port_by_index(plugin, 0U);
+  assert(port);
+
+  // Querying a port property loads the specification that defines it
+  LilvNodes* const properties =
+    lilv_port_get_value(plugin, port, lv2_portProperty);
+  assert(lilv_nodes_size(properties) == 1U);
+  assert(has_owl_classes(world));
+
+  lilv_nodes_free(properties);
+  lilv_node_free(plug_uri);
+  lilv_node_free(lv2_portProperty);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+}
+
+int
+main(void)
+{
+  test_query();
+  test_plugin_classes();
+  test_class_children();
+  test_port_accessor();
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define N_PLAIN_BUNDLES 16U
+
+static const char* const plain_manifest = "\
+:plug%u a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:comment [ rdfs:label \"Plugin %u\" ] ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const versioned_manifest = "\
+:versioned a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	lv2:minorVersion %u ;\n\
+	lv2:microVersion 0 ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static LilvTestPath*
+setup(void)
+{
+  LilvTestPath* const path = lilv_test_path_new(false);
+  char                name[32];
+  char                body[512];
+
+  for (unsigned i = 0U; i < N_PLAIN_BUNDLES; ++i) {
+    snprintf(name, sizeof(name), "plain%u.lv2", i);
+    snprintf(body, sizeof(body), plain_manifest, i, i);
+    add_test_bundle(path, name, body, "");
+  }
+
+  snprintf(body, sizeof(body), versioned_manifest, 1U);
+  add_test_bundle(path, "old.lv2", body, "");
+
+  snprintf(body, sizeof(body), versioned_manifest, 2U);
+  add_test_bundle(path, "new.lv2", body, "");
+
+  return path;
+}
+
+static LilvWorld*
+load_world(const LilvTestPath* const path, const int n_threads)
+{
+  LilvWorld* const world = lilv_test_path_world(path);
+
+  set_test_option(
+    world, LILV_OPTION_DISCOVERY_THREADS, lilv_new_int(world, n_threads));
+  lilv_world_load_all(world);
+  return world;
+}
+
+static void
+check_world(LilvWorld* const world)
+{
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  assert(lilv_plugins_size(plugins) == N_PLAIN_BUNDLES + 1U);
+
+  // Check that the newest version replaced the old one
+  LilvNode* const versioned =
+    lilv_new_uri(world, "http://example.org/versioned");
+  const LilvPlugin* const plugin = lilv_plugins_get_by_uri(plugins, versioned);
+  assert(plugin);
+
+  const char* const bundle =
+    lilv_node_as_uri(lilv_plugin_get_bundle_uri(plugin));
+  assert(strstr(bundle, "new.lv2"));
+  lilv_node_free(versioned);
+
+  // Check that blank nodes from different files are distinct
+  LilvNode* const rdfs_comment = lilv_new_uri(world, LILV_NS_RDFS "comment");
+  LilvNode* const rdfs_label   = lilv_new_uri(world, LILV_NS_RDFS "label");
+  LilvNode*       comments[N_PLAIN_BUNDLES];
+  char            uri[64];
+  char            label[32];
+  for (unsigned i = 0U; i < N_PLAIN_BUNDLES; ++i) {
+    snprintf(uri, sizeof(uri), "http://example.org/plug%u", i);
+    snprintf(label, sizeof(label), "Plugin %u", i);
+
+    LilvNode* const plug = lilv_new_uri(world, uri);
+
+    comments[i] = lilv_world_get(world, plug, rdfs_comment, NULL);
+    assert(comments[i]);
+    assert(lilv_node_is_blank(comments[i]));
+    for (unsigned j = 0U; j < i; ++j) {
+      assert(!lilv_node_equals(comments[i], comments[j]));
+    }
+
+    LilvNodes* const labels =
+      lilv_world_find_nodes(world, comments[i], rdfs_label, NULL);
+    assert(lilv_nodes_size(labels) == 1U);
+    assert(!strcmp(lilv_node_as_string(lilv_nodes_get_first(labels)), label));
+
+    lilv_nodes_free(labels);
+    lilv_node_free(plug);
+  }
+
+  for (unsigned i = 0U; i < N_PLAIN_BUNDLES; ++i) {
+    lilv_node_free(comments[i]);
+  }
+
+  lilv_node_free(rdfs_label);
+  lilv_node_free(rdfs_comment);
+}
+
+int
+main(void)
+{
+  LilvTestPath* const path = setup();
+
+  LilvWorld* const serial = load_world(path, 1);
+  check_world(serial);
+
+  LilvWorld* const parallel = load_world(path, 4);
+  check_world(parallel);
+
+  lilv_world_free(parallel);
+  lilv_world_free(serial);
+  lilv_test_path_free(path);
+  return 0;
+}
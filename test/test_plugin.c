@@ -61,6 +61,12 @@ static const char* const plugin_ttl = "\
 \n\
 :thing doap:name \"Another\"@en , \"Andere\"@de .\n";
 
+static void
+get_float(void* const user_data, const LilvNode* const node)
+{
+  *(float*)user_data = lilv_node_as_float(node);
+}
+
 static void
 set_language(LilvWorld* const world, const char* const lang)
 {
@@ -162,6 +168,25 @@ main(void)
 
   LilvNode* unknown_uri_val = lilv_new_uri(world, "http://example.org/unknown");
   assert(!lilv_nodes_contains(data_uris, unknown_uri_val));
+
+  // Nodes can be accessed by index in the order they were found
+  const LilvNode* const first_data_uri = lilv_nodes_get_at(data_uris, 0U);
+  const LilvNode* const last_data_uri  = lilv_nodes_get_at(data_uris, 1U);
+  assert(!strcmp(lilv_node_as_string(first_data_uri), manifest_uri));
+  assert(!strcmp(lilv_node_as_string(last_data_uri), data_uri));
+  assert(!lilv_nodes_get_at(data_uris, 2U));
+
+  // Large collections are also searched correctly
+  LilvNodes* many_uris = lilv_nodes_merge(data_uris, NULL);
+  while (lilv_nodes_size(many_uris) < 32U) {
+    LilvNodes* const more_uris = lilv_nodes_merge(many_uris, data_uris);
+    lilv_nodes_free(many_uris);
+    many_uris = more_uris;
+  }
+  assert(lilv_nodes_contains(many_uris, first_data_uri));
+  assert(lilv_nodes_contains(many_uris, last_data_uri));
+  assert(!lilv_nodes_contains(many_uris, unknown_uri_val));
+  lilv_nodes_free(many_uris);
   lilv_node_free(unknown_uri_val);
 
   free(manifest_uri);
@@ -174,6 +199,25 @@ main(void)
   assert(mins[0] == -1.0f);
   assert(maxs[0] == 1.0f);
   assert(defs[0] == 0.5f);
+  assert(isnan(mins[2]));
+
+  // Ranges are cached, so getting them again gives the same values
+  const float* shared_mins = NULL;
+  const float* shared_maxs = NULL;
+  const float* shared_defs = NULL;
+  lilv_plugin_get_port_range_arrays(plug, NULL, NULL, NULL);
+  lilv_plugin_get_port_range_arrays(
+    plug, &shared_mins, &shared_maxs, &shared_defs);
+  for (unsigned i = 0U; i < 2U; ++i) {
+    assert(shared_mins[i] == mins[i]);
+    assert(shared_maxs[i] == maxs[i]);
+    assert(shared_defs[i] == defs[i]);
+  }
+  assert(isnan(shared_maxs[2]));
+  assert(isnan(shared_defs[2]));
+
+  lilv_plugin_get_port_ranges_float(plug, NULL, maxs, NULL);
+  assert(maxs[1] == 2.0f);
 
   LilvNode* audio_class =
     lilv_new_uri(world, "http://lv2plug.in/ns/lv2core#AudioPort");
@@ -221,6 +265,78 @@ main(void)
   assert(lilv_plugin_has_feature(plug, event_feature));
   assert(!lilv_plugin_has_feature(plug, pretend_feature));
 
+  // The plugin is only supported by hosts with its required feature
+  LilvFeatureSet* const host = lilv_feature_set_new(world, NULL);
+  lilv_feature_set_add(host, "http://lv2plug.in/ns/lv2core#hardRTCapable");
+  assert(lilv_feature_set_contains(host, rt_feature));
+  assert(!lilv_feature_set_contains(host, event_feature));
+  assert(!lilv_plugin_is_supported(plug, host));
+
+  LilvPlugins* compatible = lilv_world_get_supported_plugins(world, host);
+  assert(!lilv_plugins_get_by_uri(compatible, plug_uri));
+  lilv_plugins_free(compatible);
+
+  lilv_feature_set_add(host, "http://lv2plug.in/ns/ext/event");
+  assert(lilv_feature_set_contains(host, event_feature));
+  assert(!lilv_feature_set_contains(host, pretend_feature));
+  assert(lilv_plugin_is_supported(plug, host));
+
+  compatible = lilv_world_get_supported_plugins(world, host);
+  assert(lilv_plugins_get_by_uri(compatible, plug_uri) == plug);
+  lilv_plugins_free(compatible);
+  lilv_feature_set_free(host);
+
+  // Feature sets from another world never match
+  LilvWorld* const      other_world = lilv_world_new();
+  LilvFeatureSet* const other_host  = lilv_feature_set_new(other_world, NULL);
+  lilv_feature_set_add(other_host, LILV_NS_LV2 "hardRTCapable");
+  lilv_feature_set_add(other_host, "http://lv2plug.in/ns/ext/event");
+  assert(!lilv_feature_set_contains(other_host, rt_feature));
+  assert(!lilv_plugin_is_supported(plug, other_host));
+  lilv_feature_set_free(other_host);
+  lilv_world_free(other_world);
+
+  // Shared values are owned by the world and can be borrowed repeatedly
+  LilvNode* const       doap_name = lilv_new_uri(world, LILV_NS_DOAP "name");
+  const LilvNode* const name      = lilv_plugin_get_shared_name(plug);
+  assert(!strcmp(lilv_node_as_string(name), "Test plugin"));
+  assert(lilv_plugin_get_shared_name(plug) == name);
+  assert(lilv_world_get_shared(world, plug_uri, doap_name, NULL) == name);
+  lilv_node_free(doap_name);
+
+  // The plugin can be found by words in its name, author, and URI
+  unsigned          n_results = 0U;
+  LilvSearchResult* results =
+    lilv_world_search_plugins(world, "TEST Plug", 0U, &n_results);
+  assert(n_results == 1U);
+  assert(results[0].plugin == plug);
+  assert(results[0].score > 0U);
+
+  LilvSearchResult* const by_author =
+    lilv_world_search_plugins(world, "david", LILV_SEARCH_AUTHOR, &n_results);
+  assert(n_results == 1U);
+  assert(by_author[0].plugin == plug);
+  assert(by_author[0].score < results[0].score);
+  lilv_free(by_author);
+  lilv_free(results);
+
+  results =
+    lilv_world_search_plugins(world, "plug", LILV_SEARCH_URI, &n_results);
+  assert(n_results == 1U);
+  assert(results[0].plugin == plug);
+  lilv_free(results);
+
+  // Words must all match, and only match within words with a flag
+  assert(!lilv_world_search_plugins(world, "test missing", 0U, &n_results));
+  assert(!n_results);
+  assert(!lilv_world_search_plugins(world, "obill", 0U, &n_results));
+  assert(!lilv_world_search_plugins(world, "", 0U, &n_results));
+  results = lilv_world_search_plugins(
+    world, "obill", LILV_SEARCH_AUTHOR | LILV_SEARCH_SUBSTRING, &n_results);
+  assert(n_results == 1U);
+  assert(results[0].plugin == plug);
+  lilv_free(results);
+
   lilv_node_free(rt_feature);
   lilv_node_free(event_feature);
   lilv_node_free(pretend_feature);
@@ -240,6 +356,11 @@ main(void)
   assert(lilv_nodes_size(foos) == 1);
   assert(fabs(lilv_node_as_float(lilv_nodes_get_first(foos)) - 1.6180) <
          FLT_EPSILON);
+
+  // Values can be visited without allocating nodes
+  float foo = 0.0f;
+  assert(lilv_plugin_foreach_value(plug, foo_p, get_float, &foo) == 1U);
+  assert(fabs(foo - 1.6180) < FLT_EPSILON);
   lilv_node_free(foo_p);
   lilv_nodes_free(foos);
 
@@ -61,6 +61,34 @@ static const char* const plugin_ttl = "\
 		lv2:name \"Audio Output\" ;\n\
 	] .\n";
 
+typedef struct {
+  const char* expected;
+  unsigned    n_matches;
+} StringCheck;
+
+static void
+check_string(void* const user_data, const LilvNode* const node)
+{
+  StringCheck* const check = (StringCheck*)user_data;
+  if (!strcmp(lilv_node_as_string(node), check->expected)) {
+    ++check->n_matches;
+  }
+}
+
+typedef struct {
+  const LilvNodes* expected;
+  unsigned         n_matches;
+} NodesCheck;
+
+static void
+check_contains(void* const user_data, const LilvNode* const node)
+{
+  NodesCheck* const check = (NodesCheck*)user_data;
+  if (lilv_nodes_contains(check->expected, node)) {
+    ++check->n_matches;
+  }
+}
+
 static void
 set_world_lang(LilvWorld* const world, const char* const lang)
 {
@@ -99,6 +127,15 @@ main(void)
   assert(p3 == NULL);
   lilv_node_free(nopsym);
 
+  LilvNode* const uri_sym = lilv_new_uri(world, "http://example.org/foo");
+  assert(!lilv_plugin_get_port_by_symbol(plug, uri_sym));
+  lilv_node_free(uri_sym);
+
+  assert(lilv_plugin_get_port_by_symbol_string(plug, "foo") == p);
+  assert(lilv_plugin_get_port_by_symbol_string(plug, "audio_out") ==
+         lilv_plugin_get_port_by_index(plug, 3));
+  assert(!lilv_plugin_get_port_by_symbol_string(plug, "thisaintnoportfoo"));
+
   // Try getting an invalid property
   LilvNode*        num     = lilv_new_int(world, 1);
   const LilvNodes* nothing = lilv_port_get_value(plug, p, num);
@@ -130,6 +167,13 @@ main(void)
   assert(!strcmp(lilv_node_as_string(name), "store"));
   lilv_node_free(name);
 
+  // Shared names are the same, but owned by the world
+  size_t                length      = 0U;
+  const LilvNode* const shared_name = lilv_port_get_shared_name(plug, p);
+  assert(!strcmp(lilv_node_as_string_counted(shared_name, &length), "store"));
+  assert(length == strlen("store"));
+  assert(lilv_port_get_shared_name(plug, p) == shared_name);
+
   // Exact language match
   set_world_lang(world, "de_DE");
   name = lilv_port_get_name(plug, p);
@@ -176,9 +220,24 @@ main(void)
     !strcmp(lilv_node_as_string(lilv_nodes_get_first(comments)), "comment"));
   LilvNode* comment = lilv_port_get(plug, p, rdfs_comment);
   assert(!strcmp(lilv_node_as_string(comment), "comment"));
+  assert(
+    lilv_node_equals(lilv_port_get_shared(plug, p, rdfs_comment), comment));
   lilv_node_free(comment);
   lilv_nodes_free(comments);
 
+  // Visited values are equal to found values, without language tags
+  comments = lilv_world_find_nodes(
+    world, lilv_port_get_node(plug, p), rdfs_comment, NULL);
+  NodesCheck nodes_check = {comments, 0U};
+  assert(lilv_world_foreach_match(world,
+                                  lilv_port_get_node(plug, p),
+                                  rdfs_comment,
+                                  NULL,
+                                  check_contains,
+                                  &nodes_check) == 1U);
+  assert(nodes_check.n_matches == 1U);
+  lilv_nodes_free(comments);
+
   set_world_lang(world, "fr");
 
   comments = lilv_port_get_value(plug, p, rdfs_comment);
@@ -186,11 +245,49 @@ main(void)
                  "commentaires"));
   lilv_nodes_free(comments);
 
+  // Visiting values selects the language the same way
+  StringCheck check = {"commentaires", 0U};
+  assert(lilv_port_foreach_value(plug, p, rdfs_comment, check_string, &check) ==
+         1U);
+  assert(check.n_matches == 1U);
+
+  // Several values can be read at once, selected by language the same way
+  LilvNode* const lv2_name = lilv_new_uri(world, LILV_NS_LV2 "name");
+  LilvNode* const missing  = lilv_new_uri(world, "http://example.org/missing");
+
+  const LilvNode* const predicates[] = {lv2_name, NULL, missing, rdfs_comment};
+  LilvNode*             values[4]    = {NULL, NULL, NULL, NULL};
+  assert(lilv_port_get_values(plug, p, 4U, predicates, values) == 2U);
+  assert(!strcmp(lilv_node_as_string(values[0]), "store"));
+  assert(!values[1]);
+  assert(!values[2]);
+  assert(!strcmp(lilv_node_as_string(values[3]), "commentaires"));
+  for (unsigned i = 0U; i < 4U; ++i) {
+    lilv_node_free(values[i]);
+  }
+
+  // More predicates than are selected in a single pass
+  const LilvNode* many_predicates[20] = {NULL};
+  LilvNode*       many_values[20]     = {NULL};
+  many_predicates[3]                  = lv2_name;
+  many_predicates[17]                 = rdfs_comment;
+  assert(lilv_port_get_values(plug, p, 20U, many_predicates, many_values) ==
+         2U);
+  assert(!strcmp(lilv_node_as_string(many_values[3]), "store"));
+  assert(!strcmp(lilv_node_as_string(many_values[17]), "commentaires"));
+  for (unsigned i = 0U; i < 20U; ++i) {
+    lilv_node_free(many_values[i]);
+  }
+
+  lilv_node_free(missing);
+  lilv_node_free(lv2_name);
+
   set_world_lang(world, "cn");
 
   comments = lilv_port_get_value(plug, p, rdfs_comment);
   assert(!comments);
   lilv_nodes_free(comments);
+  assert(!lilv_port_foreach_value(plug, p, rdfs_comment, check_string, &check));
 
   lilv_node_free(rdfs_comment);
 
@@ -216,6 +313,25 @@ main(void)
      (!strcmp(lilv_node_as_string(lilv_scale_point_get_label(sp1)), "Sin") &&
       lilv_node_as_float(lilv_scale_point_get_value(sp1)) == 3)));
 
+  // Sorted scale points are owned by the plugin and ordered by value
+  const LilvScalePoints* sorted = lilv_port_get_sorted_scale_points(plug, p);
+  assert(lilv_scale_points_size(sorted) == 2);
+  assert(lilv_port_get_sorted_scale_points(plug, p) == sorted);
+
+  const LilvScalePoint* sin_point =
+    lilv_scale_points_get(sorted, lilv_scale_points_begin(sorted));
+  assert(!strcmp(lilv_node_as_string(lilv_scale_point_get_label(sin_point)),
+                 "Sin"));
+
+  // Scale points can be looked up by value or label
+  assert(lilv_port_get_scale_point_by_value(plug, p, 3.0f) == sin_point);
+  assert(lilv_port_get_scale_point_by_label(plug, p, "Sin") == sin_point);
+  assert(lilv_node_as_float(lilv_scale_point_get_value(
+           lilv_port_get_scale_point_by_label(plug, p, "Cos"))) == 4.0f);
+  assert(!lilv_port_get_scale_point_by_value(plug, p, 3.5f));
+  assert(!lilv_port_get_scale_point_by_value(plug, p, 5.0f));
+  assert(!lilv_port_get_scale_point_by_label(plug, p, "Tan"));
+
   LilvNode* homepage_p =
     lilv_new_uri(world, "http://usefulinc.com/ns/doap#homepage");
   LilvNodes* homepages = lilv_plugin_get_value(plug, homepage_p);
@@ -266,6 +382,13 @@ main(void)
   names = lilv_port_get_value(plug, p, name_p);
   assert(lilv_nodes_size(names) == 4);
   lilv_nodes_free(names);
+
+  const LilvNode* const port_node = lilv_port_get_node(plug, p);
+  check.expected                  = "store";
+  check.n_matches                 = 0U;
+  assert(lilv_world_foreach_match(
+           world, port_node, name_p, NULL, check_string, &check) == 4U);
+  assert(check.n_matches == 1U);
   lilv_world_set_option(world, LILV_OPTION_FILTER_LANG, true_val);
 
   lilv_node_free(false_val);
@@ -297,6 +420,20 @@ main(void)
   assert(lilv_plugin_get_num_ports_of_class(
            plug, audio_class, out_class, NULL) == 1);
 
+  // Classes and properties that aren't well-known are also supported
+  LilvNode* event_class =
+    lilv_new_uri(world, "http://lv2plug.in/ns/lv2core#EventPort");
+
+  assert(lilv_port_is_a(plug, ep, event_class));
+  assert(!lilv_port_is_a(plug, ap_in, event_class));
+  assert(!lilv_port_has_property(plug, p, event_type));
+  assert(lilv_plugin_get_num_ports_of_class(plug, event_class, NULL) == 1);
+  assert(lilv_plugin_get_num_ports_of_class(
+           plug, in_class, event_class, NULL) == 1);
+  assert(lilv_plugin_get_num_ports_of_class(
+           plug, event_class, out_class, NULL) == 0);
+
+  lilv_node_free(event_class);
   lilv_nodes_free(names);
   lilv_node_free(name_p);
 
@@ -0,0 +1,139 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+#include <lv2/atom/atom.h>
+#include <lv2/core/lv2.h>
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+static const char* const plugin_ttl = "\
+@prefix pprops: <http://lv2plug.in/ns/ext/port-props#> .\n\
+:plug\n\
+	a lv2:Plugin ;\n\
+	doap:name \"Test plugin\" ;\n\
+	lv2:port [\n\
+		a lv2:ControlPort , lv2:InputPort ;\n\
+		lv2:index 0 ;\n\
+		lv2:symbol \"gain\" ;\n\
+		lv2:name \"Gain\" ;\n\
+		lv2:portProperty lv2:integer , pprops:logarithmic , <urn:unknown> ;\n\
+		lv2:minimum -1 ;\n\
+		lv2:maximum 1.0 ;\n\
+		lv2:default 0.5\n\
+	] , [\n\
+		a atom:AtomPort , lv2:InputPort ;\n\
+		lv2:index 1 ;\n\
+		lv2:symbol \"control\" ;\n\
+		lv2:name \"Control\" ;\n\
+		lv2:designation lv2:control ;\n\
+		atom:bufferType atom:Sequence\n\
+	] , [\n\
+		a lv2:ControlPort , lv2:OutputPort ;\n\
+		lv2:index 2 ;\n\
+		lv2:symbol \"latency\" ;\n\
+		lv2:name \"Latency\" ;\n\
+		lv2:portProperty lv2:reportsLatency , pprops:notOnGUI\n\
+	] , [\n\
+		a lv2:AudioPort , lv2:OutputPort ;\n\
+		lv2:index 3 ;\n\
+		lv2:symbol \"out\" ;\n\
+		lv2:name \"Out\" ;\n\
+		lv2:designation :left , :main\n\
+	] .\n";
+
+int
+main(void)
+{
+  LilvTestEnv* const env   = lilv_test_env_new();
+  LilvWorld* const   world = env->world;
+
+  if (create_bundle(env, "port_table.lv2", SIMPLE_MANIFEST_TTL, plugin_ttl)) {
+    return 1;
+  }
+
+  lilv_world_load_specifications(env->world);
+  lilv_world_load_bundle(env->world, env->test_bundle_uri);
+
+  const LilvPlugins* plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin*  plug = lilv_plugins_get_by_uri(plugins, env->plugin1_uri);
+  assert(plug);
+
+  const LilvPortInfo* const table = lilv_plugin_get_port_table(plug);
+  assert(table);
+  assert(lilv_plugin_get_port_table(plug) == table);
+  assert(lilv_plugin_get_num_ports(plug) == 4U);
+
+  // Control input with a range and some properties, one of which is unknown
+  assert(table[0].index == 0U);
+  assert(!strcmp(table[0].symbol, "gain"));
+  assert(table[0].direction == LILV_PORT_DIRECTION_INPUT);
+  assert(table[0].data_type == LILV_PORT_DATA_CONTROL);
+  assert(table[0].def == 0.5f);
+  assert(table[0].min == -1.0f);
+  assert(table[0].max == 1.0f);
+  assert(table[0].properties == (LILV_PORT_INTEGER | LILV_PORT_LOGARITHMIC));
+  assert(!table[0].designation);
+  assert(!table[0].buffer_type);
+
+  // Atom input with a designation and a buffer type
+  LilvNode* const control  = lilv_new_uri(world, LV2_CORE__control);
+  LilvNode* const sequence = lilv_new_uri(world, LV2_ATOM__Sequence);
+  assert(table[1].index == 1U);
+  assert(!strcmp(table[1].symbol, "control"));
+  assert(table[1].direction == LILV_PORT_DIRECTION_INPUT);
+  assert(table[1].data_type == LILV_PORT_DATA_ATOM);
+  assert(isnan(table[1].def));
+  assert(isnan(table[1].min));
+  assert(isnan(table[1].max));
+  assert(!table[1].properties);
+  assert(lilv_node_equals(table[1].designation, control));
+  assert(lilv_node_equals(table[1].buffer_type, sequence));
+  lilv_node_free(sequence);
+
+  // Control output that reports latency
+  assert(table[2].direction == LILV_PORT_DIRECTION_OUTPUT);
+  assert(table[2].data_type == LILV_PORT_DATA_CONTROL);
+  assert(table[2].properties ==
+         (LILV_PORT_REPORTS_LATENCY | LILV_PORT_NOT_ON_GUI));
+
+  // Audio output
+  assert(table[3].direction == LILV_PORT_DIRECTION_OUTPUT);
+  assert(table[3].data_type == LILV_PORT_DATA_AUDIO);
+  assert(!strcmp(table[3].symbol, "out"));
+
+  // Ports can be found by any of their designations
+  LilvNode* const in_class  = lilv_new_uri(world, LV2_CORE__InputPort);
+  LilvNode* const out_class = lilv_new_uri(world, LV2_CORE__OutputPort);
+  LilvNode* const left      = lilv_new_uri(world, "http://example.org/left");
+  LilvNode* const main_des  = lilv_new_uri(world, "http://example.org/main");
+  const LilvPort* const out = lilv_plugin_get_port_by_index(plug, 3U);
+  assert(lilv_node_equals(table[3].designation, left));
+  assert(lilv_plugin_get_port_by_designation(plug, NULL, left) == out);
+  assert(lilv_plugin_get_port_by_designation(plug, out_class, main_des) == out);
+  assert(!lilv_plugin_get_port_by_designation(plug, in_class, main_des));
+  assert(lilv_plugin_get_port_by_designation(plug, in_class, control) ==
+         lilv_plugin_get_port_by_index(plug, 1U));
+  assert(!lilv_plugin_get_port_by_designation(plug, out_class, control));
+  lilv_node_free(main_des);
+  lilv_node_free(left);
+  lilv_node_free(out_class);
+  lilv_node_free(in_class);
+
+  // The latency port is found by its property
+  assert(lilv_plugin_has_latency(plug));
+  assert(lilv_plugin_get_latency_port_index(plug) == 2U);
+
+  lilv_node_free(control);
+
+  delete_bundle(env);
+  lilv_test_env_free(env);
+
+  return 0;
+}
@@ -79,6 +79,14 @@ main(void)
   assert(!strcmp(lilv_node_as_string(author_homepage), "http://drobilla.net"));
   lilv_node_free(author_homepage);
 
+  // The shared project is the same node, owned by the world
+  LilvNode* const       project = lilv_plugin_get_project(plug);
+  const LilvNode* const shared  = lilv_plugin_get_shared_project(plug);
+  assert(lilv_node_is_blank(shared));
+  assert(lilv_node_equals(shared, project));
+  assert(lilv_plugin_get_shared_project(plug) == shared);
+  lilv_node_free(project);
+
   delete_bundle(env);
   lilv_test_env_free(env);
 
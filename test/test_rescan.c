@@ -0,0 +1,163 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char* const first_manifest = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const second_manifest = "\
+:foobar a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const changed_manifest = "\
+:foobar a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n\
+:baz a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const original_plugin = "\
+:foobar doap:name \"Original name\" .\n";
+
+static const char* const changed_plugin = "\
+:foobar doap:name \"Changed name\" .\n";
+
+static const char* const spec_manifest = "\
+:spec a lv2:Specification ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const changed_spec_manifest = "\
+:spec a lv2:Specification ;\n\
+	rdfs:comment \"Changed\" ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const spec_data = "\
+:spec :has [ :value 1 ] .\n";
+
+static bool
+has_plugin(LilvWorld* const world, const char* const uri)
+{
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const bool result = lilv_plugins_get_by_uri(plugins, node) != NULL;
+
+  lilv_node_free(node);
+  return result;
+}
+
+static bool
+plugin_has_name(LilvWorld* const   world,
+                const char* const uri,
+                const char* const name)
+{
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin  = lilv_plugins_get_by_uri(plugins, node);
+  LilvNode* const          value   = lilv_plugin_get_name(plugin);
+  const bool result = value && !strcmp(lilv_node_as_string(value), name);
+
+  lilv_node_free(value);
+  lilv_node_free(node);
+  return result;
+}
+
+static unsigned
+num_plugins(const LilvWorld* const world)
+{
+  return lilv_plugins_size(lilv_world_get_all_plugins(world));
+}
+
+static unsigned
+num_spec_values(LilvWorld* const world)
+{
+  LilvNode* const  spec   = lilv_new_uri(world, "http://example.org/spec");
+  LilvNode* const  has    = lilv_new_uri(world, "http://example.org/has");
+  LilvNodes* const values = lilv_world_find_nodes(world, spec, has, NULL);
+  const unsigned   n      = lilv_nodes_size(values);
+
+  lilv_nodes_free(values);
+  lilv_node_free(has);
+  lilv_node_free(spec);
+  return n;
+}
+
+int
+main(void)
+{
+  LilvTestPath* const path  = lilv_test_path_new(false);
+  LilvWorld* const    world = lilv_test_path_world(path);
+
+  // Load a world with a single bundle
+  LilvTestBundle* const first =
+    add_test_bundle(path, "first.lv2", first_manifest, "");
+  lilv_world_load_all(world);
+  assert(num_plugins(world) == 1U);
+  assert(has_plugin(world, "http://example.org/plug"));
+
+  // Rescanning with nothing changed does nothing
+  assert(!lilv_world_rescan(world));
+  assert(num_plugins(world) == 1U);
+
+  // Install a new bundle
+  const LilvTestBundle* const second =
+    add_test_bundle(path, "second.lv2", second_manifest, original_plugin);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_plugins(world) == 2U);
+  assert(has_plugin(world, "http://example.org/foobar"));
+
+  // Modify the new bundle (which also changes the size of its manifest)
+  write_test_file(
+    second->manifest_path, MANIFEST_PREFIXES, changed_manifest);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_plugins(world) == 3U);
+  assert(has_plugin(world, "http://example.org/baz"));
+
+  // Load the plugin data, then edit it in place without touching the manifest
+  assert(plugin_has_name(world, "http://example.org/foobar", "Original name"));
+  write_test_file(second->plugin_path, PLUGIN_PREFIXES, changed_plugin);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_plugins(world) == 3U);
+  assert(plugin_has_name(world, "http://example.org/foobar", "Changed name"));
+  assert(!lilv_world_rescan(world));
+
+  // Remove the first bundle
+  remove_test_bundle(first);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_plugins(world) == 2U);
+  assert(!has_plugin(world, "http://example.org/plug"));
+  assert(has_plugin(world, "http://example.org/foobar"));
+  assert(has_plugin(world, "http://example.org/baz"));
+
+  assert(!lilv_world_rescan(world));
+
+  // Install a specification with a blank node in its data
+  const LilvTestBundle* const spec =
+    add_test_bundle(path, "spec.lv2", spec_manifest, spec_data);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_spec_values(world) == 1U);
+
+  // Reloading the bundle doesn't read the specification data again
+  write_test_file(
+    spec->manifest_path, MANIFEST_PREFIXES, changed_spec_manifest);
+  assert(lilv_world_rescan(world) == 1U);
+  assert(num_spec_values(world) == 1U);
+  assert(!lilv_world_rescan(world));
+  assert(num_spec_values(world) == 1U);
+
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+  return 0;
+}
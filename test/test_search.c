@@ -0,0 +1,100 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+static const char* const alpha_manifest = "\
+:alpha a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const alpha_plugin = "\
+:alpha doap:name \"Alpha synth\" .\n";
+
+static const char* const beta_manifest = "\
+:beta a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const beta_plugin = "\
+:beta doap:name \"Beta delay\" .\n";
+
+/// Return the number of plugins found, and check that `uri` is first if given
+static unsigned
+count_results(LilvWorld* const  world,
+              const char* const query,
+              const uint32_t    flags,
+              const char* const uri)
+{
+  unsigned                n_results = 0U;
+  LilvSearchResult* const results =
+    lilv_world_search_plugins(world, query, flags, &n_results);
+
+  if (uri) {
+    assert(n_results);
+    const LilvNode* const first = lilv_plugin_get_uri(results[0].plugin);
+    assert(!strcmp(lilv_node_as_uri(first), uri));
+  }
+
+  lilv_free(results);
+  return n_results;
+}
+
+int
+main(void)
+{
+  LilvTestPath* const         path = lilv_test_path_new(false);
+  const LilvTestBundle* const alpha =
+    add_test_bundle(path, "alpha.lv2", alpha_manifest, alpha_plugin);
+  const LilvTestBundle* const beta =
+    add_test_bundle(path, "beta.lv2", beta_manifest, beta_plugin);
+
+  LilvWorld* const world     = lilv_test_path_world(path);
+  LilvNode* const  alpha_uri = test_bundle_uri(world, alpha);
+  LilvNode* const  beta_uri  = test_bundle_uri(world, beta);
+
+  // Plugins can be found by their URIs without loading their data
+  lilv_world_load_bundle(world, alpha_uri);
+  assert(count_results(world, "alpha", 0U, "http://example.org/alpha") == 1U);
+  assert(!count_results(world, "synth", 0U, NULL));
+
+  // Searching with the load flag loads and indexes plugin data
+  assert(count_results(world, "synth", LILV_SEARCH_LOAD, NULL) == 1U);
+  assert(count_results(world, "synth", 0U, NULL) == 1U);
+
+  // Loading another bundle adds its plugin to the existing index
+  lilv_world_load_bundle(world, beta_uri);
+  assert(count_results(world, "example", LILV_SEARCH_URI, NULL) == 2U);
+  assert(!count_results(world, "delay", 0U, NULL));
+
+  // Data loaded by other calls is indexed before the next search
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  LilvNode* const plug_uri = lilv_new_uri(world, "http://example.org/beta");
+  LilvNode* const name =
+    lilv_plugin_get_name(lilv_plugins_get_by_uri(plugins, plug_uri));
+  assert(name);
+  assert(count_results(world, "delay", 0U, "http://example.org/beta") == 1U);
+
+  // Unloading a bundle removes its plugin from the index
+  lilv_world_unload_bundle(world, alpha_uri);
+  assert(!count_results(world, "synth", 0U, NULL));
+  assert(count_results(world, "example", LILV_SEARCH_URI, NULL) == 1U);
+  assert(count_results(world, "delay", 0U, NULL) == 1U);
+
+  lilv_node_free(name);
+  lilv_node_free(plug_uri);
+  lilv_node_free(beta_uri);
+  lilv_node_free(alpha_uri);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+  return 0;
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char* const versioned_manifest = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	lv2:minorVersion %u ;\n\
+	lv2:microVersion 0 ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const plugin_ttl = "\
+:plug doap:name \"Test plugin\" .\n";
+
+typedef struct {
+  unsigned      n_records;
+  LilvLoadStats total;
+} StatsSummary;
+
+static void
+add_bundle(LilvTestPath* const path, const char* const name, const unsigned v)
+{
+  char manifest[512];
+  snprintf(manifest, sizeof(manifest), versioned_manifest, v);
+  add_test_bundle(path, name, manifest, plugin_ttl);
+}
+
+static void
+summarize(void* const                user_data,
+          const LilvNode* const      uri,
+          const LilvLoadStats* const stats)
+{
+  StatsSummary* const summary = (StatsSummary*)user_data;
+
+  assert(lilv_node_is_uri(uri));
+  ++summary->n_records;
+  summary->total.n_files += stats->n_files;
+  summary->total.n_bytes += stats->n_bytes;
+  summary->total.n_statements += stats->n_statements;
+  summary->total.version_time += stats->version_time;
+}
+
+static StatsSummary
+summarize_bundles(const LilvWorld* const world)
+{
+  StatsSummary summary = {0U, {0U, 0U, 0U, 0U, 0U, 0U}};
+  lilv_world_get_bundle_stats(world, summarize, &summary);
+  return summary;
+}
+
+static StatsSummary
+summarize_files(const LilvWorld* const world)
+{
+  StatsSummary summary = {0U, {0U, 0U, 0U, 0U, 0U, 0U}};
+  lilv_world_get_file_stats(world, summarize, &summary);
+  return summary;
+}
+
+static void
+test_disabled(const LilvTestPath* const path)
+{
+  LilvWorld* const world = lilv_test_path_world(path);
+  lilv_world_load_all(world);
+
+  LilvWorldStats stats;
+  assert(lilv_world_get_stats(world, &stats));
+  assert(!stats.total.n_files);
+  assert(!summarize_bundles(world).n_records);
+  assert(!summarize_files(world).n_records);
+
+  lilv_world_free(world);
+}
+
+static void
+test_enabled(const LilvTestPath* const path)
+{
+  LilvWorld* const world = lilv_test_path_world(path);
+  set_test_option(world, LILV_OPTION_STATS, lilv_new_bool(world, true));
+  lilv_world_load_all(world);
+
+  // Both manifests are loaded, and the versions compared
+  LilvWorldStats world_stats;
+  assert(!lilv_world_get_stats(world, &world_stats));
+  assert(world_stats.total.n_files == 2U);
+  assert(world_stats.total.n_bytes > 0U);
+  assert(world_stats.total.n_statements > 0U);
+  assert(world_stats.total.version_time > 0U);
+  assert(!world_stats.n_plugin_loads);
+
+  // Statistics for bundles and files add up to the totals
+  StatsSummary bundles = summarize_bundles(world);
+  StatsSummary files   = summarize_files(world);
+  assert(bundles.n_records == 2U);
+  assert(bundles.total.n_files == 2U);
+  assert(bundles.total.version_time == world_stats.total.version_time);
+  assert(files.n_records == 2U);
+  assert(files.total.n_bytes == world_stats.total.n_bytes);
+  assert(files.total.n_statements == world_stats.total.n_statements);
+
+  // Loading the plugin loads its data files
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin  = lilv_plugins_get(
+    plugins, lilv_plugins_begin(plugins));
+  LilvNode* const name = lilv_plugin_get_name(plugin);
+  assert(!strcmp(lilv_node_as_string(name), "Test plugin"));
+  lilv_node_free(name);
+
+  assert(!lilv_world_get_stats(world, &world_stats));
+  assert(world_stats.n_plugin_loads == 1U);
+  assert(world_stats.total.n_files == 3U);
+
+  bundles = summarize_bundles(world);
+  files   = summarize_files(world);
+  assert(bundles.n_records == 2U);
+  assert(bundles.total.n_files == 3U);
+  assert(files.n_records == 3U);
+  assert(files.total.n_bytes == world_stats.total.n_bytes);
+
+  lilv_world_free(world);
+}
+
+int
+main(void)
+{
+  LilvTestPath* const path = lilv_test_path_new(false);
+
+  add_bundle(path, "old.lv2", 1U);
+  add_bundle(path, "new.lv2", 2U);
+
+  test_disabled(path);
+  test_enabled(path);
+
+  lilv_test_path_free(path);
+  return 0;
+}
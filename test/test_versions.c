@@ -0,0 +1,80 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdio.h>
+
+static const char* const versioned_manifest = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	lv2:minorVersion %u ;\n\
+	lv2:microVersion %u .\n";
+
+static void
+write_manifest(const LilvTestBundle* const bundle,
+               const unsigned              minor,
+               const unsigned              micro)
+{
+  char manifest[512];
+  snprintf(manifest, sizeof(manifest), versioned_manifest, minor, micro);
+  write_test_file(bundle->manifest_path, MANIFEST_PREFIXES, manifest);
+}
+
+static LilvTestBundle*
+add_bundle(LilvTestPath* const path,
+           const char* const   name,
+           const unsigned      minor,
+           const unsigned      micro)
+{
+  LilvTestBundle* const bundle = add_test_bundle(path, name, "", "");
+  write_manifest(bundle, minor, micro);
+  return bundle;
+}
+
+static const LilvNode*
+loaded_bundle(const LilvWorld* const world)
+{
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  assert(lilv_plugins_size(plugins) == 1U);
+
+  const LilvPlugin* const plugin =
+    lilv_plugins_get(plugins, lilv_plugins_begin(plugins));
+
+  return lilv_plugin_get_bundle_uri(plugin);
+}
+
+int
+main(void)
+{
+  LilvTestPath* const path = lilv_test_path_new(false);
+
+  add_bundle(path, "a.lv2", 1U, 0U);
+  const LilvTestBundle* const b = add_bundle(path, "b.lv2", 2U, 1U);
+  const LilvTestBundle* const c = add_bundle(path, "c.lv2", 1U, 5U);
+
+  LilvWorld* const world = lilv_test_path_world(path);
+  lilv_world_load_all(world);
+
+  // The newest version is loaded regardless of the order bundles are found
+  LilvNode* const b_uri = test_bundle_uri(world, b);
+  LilvNode* const c_uri = test_bundle_uri(world, c);
+  assert(lilv_node_equals(loaded_bundle(world), b_uri));
+
+  // Reloading a changed bundle uses the new version, not the recorded one
+  write_manifest(c, 3U, 0U);
+  lilv_world_unload_bundle(world, c_uri);
+  lilv_world_load_bundle(world, c_uri);
+  assert(lilv_node_equals(loaded_bundle(world), c_uri));
+
+  lilv_node_free(c_uri);
+  lilv_node_free(b_uri);
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+  return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "lilv_test_utils.h"
+
+#include <lilv/lilv.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char* const first_manifest = "\
+:plug a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const second_manifest = "\
+:foobar a lv2:Plugin ;\n\
+	lv2:binary <foo" SHLIB_EXT "> ;\n\
+	rdfs:seeAlso <plugin.ttl> .\n";
+
+static const char* const plugin_ttl = "\
+:foobar doap:name \"Original name\" .\n";
+
+static const char* const changed_plugin_ttl = "\
+:foobar doap:name \"Changed name\" .\n";
+
+static const LilvPlugin*
+get_plugin(LilvWorld* const world, const char* const uri)
+{
+  LilvNode* const          node    = lilv_new_uri(world, uri);
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin  = lilv_plugins_get_by_uri(plugins, node);
+
+  lilv_node_free(node);
+  return plugin;
+}
+
+static bool
+has_name(const LilvPlugin* const plugin, const char* const name)
+{
+  LilvNode* const plugin_name = lilv_plugin_get_name(plugin);
+  const bool      result =
+    plugin_name && !strcmp(lilv_node_as_string(plugin_name), name);
+
+  lilv_node_free(plugin_name);
+  return result;
+}
+
+static unsigned
+num_plugins(const LilvWorld* const world)
+{
+  return lilv_plugins_size(lilv_world_get_all_plugins(world));
+}
+
+int
+main(void)
+{
+  LilvTestPath* const path  = lilv_test_path_new(false);
+  LilvWorld* const    world = lilv_test_path_world(path);
+
+  // Load a world with a single bundle
+  LilvTestBundle* const first =
+    add_test_bundle(path, "first.lv2", first_manifest, plugin_ttl);
+  lilv_world_load_all(world);
+  assert(num_plugins(world) == 1U);
+
+  // Without watching, there's never anything to apply
+  assert(lilv_world_get_watch_fd(world) == -1);
+  assert(!lilv_world_apply_changes(world));
+
+  if (lilv_world_watch(world)) {
+    // Watching isn't supported on this platform
+    assert(lilv_world_get_watch_fd(world) == -1);
+  } else {
+    assert(lilv_world_get_watch_fd(world) >= 0);
+    assert(!lilv_world_apply_changes(world));
+
+    // Install a new bundle, which is only loaded when changes are applied
+    LilvTestBundle* const second =
+      add_test_bundle(path, "second.lv2", second_manifest, plugin_ttl);
+    assert(num_plugins(world) == 1U);
+    assert(lilv_world_apply_changes(world) == 1U);
+    assert(num_plugins(world) == 2U);
+
+    const LilvPlugin* plugin = get_plugin(world, "http://example.org/foobar");
+    assert(plugin);
+    assert(has_name(plugin, "Original name"));
+
+    // Change only a data file, which is noticed without rescanning
+    write_test_file(second->plugin_path, PLUGIN_PREFIXES, changed_plugin_ttl);
+    assert(lilv_world_apply_changes(world) == 1U);
+    assert(num_plugins(world) == 2U);
+
+    plugin = get_plugin(world, "http://example.org/foobar");
+    assert(plugin);
+    assert(has_name(plugin, "Changed name"));
+
+    // Remove the first bundle
+    remove_test_bundle(first);
+    assert(lilv_world_apply_changes(world) == 1U);
+    assert(num_plugins(world) == 1U);
+    assert(!get_plugin(world, "http://example.org/plug"));
+
+    // Everything has been applied
+    assert(!lilv_world_apply_changes(world));
+
+    remove_test_bundle(second);
+    assert(lilv_world_apply_changes(world) == 1U);
+    assert(!num_plugins(world));
+  }
+
+  lilv_world_free(world);
+  lilv_test_path_free(path);
+  return 0;
+}
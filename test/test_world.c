@@ -8,7 +8,13 @@
 #include <lilv/lilv.h>
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
+
+static const char* const plugin_ttl = "\
+:plug a lv2:Plugin ;\n\
+	doap:name \"Test plugin\" .\n";
 
 static void
 test_free(void)
@@ -74,6 +80,138 @@ test_search(void)
   lilv_test_env_free(env);
 }
 
+static void
+test_load_file(const bool mmap)
+{
+  LilvTestEnv* const env    = lilv_test_env_new();
+  LilvWorld* const   world  = env->world;
+  LilvNode* const    option = lilv_new_bool(world, mmap);
+
+  lilv_world_set_option(world, LILV_OPTION_MMAP, option);
+  assert(!create_bundle(env, "load_file.lv2", SIMPLE_MANIFEST_TTL, plugin_ttl));
+  lilv_world_load_bundle(world, env->test_bundle_uri);
+
+  // Data files are read the same way regardless of how they're mapped
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin =
+    lilv_plugins_get_by_uri(plugins, env->plugin1_uri);
+  assert(plugin);
+
+  LilvNode* const name = lilv_plugin_get_name(plugin);
+  assert(name);
+  assert(!strcmp(lilv_node_as_string(name), "Test plugin"));
+
+  lilv_node_free(name);
+  lilv_node_free(option);
+  delete_bundle(env);
+  lilv_test_env_free(env);
+}
+
+static void
+test_get_plugin_by_uri(void)
+{
+  LilvTestEnv* const env   = lilv_test_env_new();
+  LilvWorld* const   world = env->world;
+
+  assert(!create_bundle(env, "by_uri.lv2", SIMPLE_MANIFEST_TTL, plugin_ttl));
+  lilv_world_load_bundle(world, env->test_bundle_uri);
+
+  const LilvPlugins* const plugins = lilv_world_get_all_plugins(world);
+  const LilvPlugin* const  plugin =
+    lilv_plugins_get_by_uri(plugins, env->plugin1_uri);
+  assert(plugin);
+
+  // Plugins can be found by URI string, but only while they're loaded
+  assert(lilv_world_get_plugin_by_uri(world, "http://example.org/plug") ==
+         plugin);
+  assert(!lilv_world_get_plugin_by_uri(world, "http://example.org/missing"));
+
+  lilv_world_unload_bundle(world, env->test_bundle_uri);
+  assert(!lilv_world_get_plugin_by_uri(world, "http://example.org/plug"));
+  assert(!lilv_plugins_get_by_uri(plugins, env->plugin1_uri));
+
+  // Reloading the bundle revives the same plugin
+  lilv_world_load_bundle(world, env->test_bundle_uri);
+  assert(lilv_world_get_plugin_by_uri(world, "http://example.org/plug") ==
+         plugin);
+  assert(lilv_plugins_get_by_uri(plugins, env->plugin1_uri) == plugin);
+
+  delete_bundle(env);
+  lilv_test_env_free(env);
+}
+
+static void
+check_name(LilvWorld* const      world,
+           const LilvNode* const subject,
+           const LilvNode* const predicate,
+           const char* const     expected)
+{
+  LilvNode* const name = lilv_world_get(world, subject, predicate, NULL);
+  if (expected) {
+    assert(name);
+    assert(!strcmp(lilv_node_as_string(name), expected));
+  } else {
+    assert(!name);
+  }
+
+  lilv_node_free(name);
+}
+
+static void
+test_query_cache(void)
+{
+  LilvTestEnv* const env   = lilv_test_env_new();
+  LilvWorld* const   world = env->world;
+  LilvNode* const    size  = lilv_new_int(world, 2);
+
+  lilv_world_set_option(world, LILV_OPTION_QUERY_CACHE_SIZE, size);
+  assert(!create_bundle(env, "cache.lv2", SIMPLE_MANIFEST_TTL, plugin_ttl));
+  lilv_world_load_bundle(world, env->test_bundle_uri);
+
+  LilvNode* const plug       = lilv_new_uri(world, "http://example.org/plug");
+  LilvNode* const name       = lilv_new_uri(world, LILV_NS_DOAP "name");
+  LilvNode* const type       = lilv_new_uri(world, LILV_NS_RDF "type");
+  LilvNode* const lv2_plugin = lilv_new_uri(world, LILV_NS_LV2 "Plugin");
+
+  // Repeated queries are answered by the cache until data is loaded
+  LilvWorldStats stats;
+  check_name(world, plug, name, NULL);
+  lilv_world_load_resource(world, plug);
+  check_name(world, plug, name, "Test plugin");
+  check_name(world, plug, name, "Test plugin");
+  lilv_world_get_stats(world, &stats);
+  assert(stats.n_query_misses == 2U);
+  assert(stats.n_query_hits == 1U);
+
+  // Queries with objects are cached too, and the cache is dropped when full
+  LilvNode* const subject = lilv_world_get(world, NULL, type, lv2_plugin);
+  assert(lilv_node_equals(subject, plug));
+  lilv_node_free(subject);
+  check_name(world, lv2_plugin, name, NULL);
+  check_name(world, plug, name, "Test plugin");
+  lilv_world_get_stats(world, &stats);
+  assert(stats.n_query_misses == 5U);
+  assert(stats.n_query_hits == 1U);
+
+  // Cached results are dropped when bundles are unloaded or loaded
+  lilv_world_unload_bundle(world, env->test_bundle_uri);
+  check_name(world, plug, name, NULL);
+  lilv_world_load_bundle(world, env->test_bundle_uri);
+  lilv_world_load_resource(world, plug);
+  check_name(world, plug, name, "Test plugin");
+  lilv_world_get_stats(world, &stats);
+  assert(stats.n_query_misses == 7U);
+  assert(stats.n_query_hits == 1U);
+
+  lilv_node_free(lv2_plugin);
+  lilv_node_free(type);
+  lilv_node_free(name);
+  lilv_node_free(plug);
+  lilv_node_free(size);
+  delete_bundle(env);
+  lilv_test_env_free(env);
+}
+
 int
 main(void)
 {
@@ -81,4 +219,8 @@ main(void)
   test_set_option();
   test_load_plugin_classes();
   test_search();
+  test_load_file(false);
+  test_load_file(true);
+  test_get_plugin_by_uri();
+  test_query_cache();
 }
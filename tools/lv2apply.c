@@ -304,9 +304,8 @@ main(int argc, char** argv)
   /* Set control values */
   for (unsigned i = 0; i < self.n_params; ++i) {
     const Param*    param = &self.params[i];
-    LilvNode*       sym   = lilv_new_string(self.world, param->sym);
-    const LilvPort* port  = lilv_plugin_get_port_by_symbol(plugin, sym);
-    lilv_node_free(sym);
+    const LilvPort* port  =
+      lilv_plugin_get_port_by_symbol_string(plugin, param->sym);
     if (!port) {
       return fatal(&self, 7, "Unknown port `%s'\n", param->sym);
     }